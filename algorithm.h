@@ -2,7 +2,9 @@
 #define GROEBNER_ALGORITHM_H
 
 #include "polynomial.h"
+#include "basis.h"
 #include "helpers.h"
+#include "control.h"
 
 namespace Groebner {
     template <typename FieldElement, typename OrderType>
@@ -19,8 +21,7 @@ namespace Groebner {
 
         Monomial monomialQuotient = Poly::getMonomial(*divisibleTermPtr) / Poly::getMonomial(leadingTerm);
         FieldElement coefficientQuotient = Poly::getCoefficient(*divisibleTermPtr) / Poly::getCoefficient(leadingTerm);
-        Poly quotient({{monomialQuotient, coefficientQuotient}});
-        *g -= quotient * f;
+        g->subtractMultiple(monomialQuotient, coefficientQuotient, f);
         return true;
     }
 
@@ -42,11 +43,14 @@ namespace Groebner {
         Monomial lcm12 = lcm(Poly::getMonomial(leadingTerm1), Poly::getMonomial(leadingTerm2));
         Monomial m1 = lcm12 / Poly::getMonomial(leadingTerm1);
         Monomial m2 = lcm12 / Poly::getMonomial(leadingTerm2);
-        return f1 * m1 * Poly::getCoefficient(leadingTerm2) - f2 * m2 * Poly::getCoefficient(leadingTerm1);
+        Poly result;
+        result.addMultiple(m1, Poly::getCoefficient(leadingTerm2), f1);
+        result.subtractMultiple(m2, Poly::getCoefficient(leadingTerm1), f2);
+        return result;
     }
 
-    template <typename FieldElement, typename OrderType>
-    bool TryReduceOverSetOnce(const PolynomialSet<FieldElement, OrderType>& set, Polynomial<FieldElement, OrderType>* g) {
+    template <typename Container, typename FieldElement, typename OrderType>
+    bool TryReduceOverSetOnce(const Container& set, Polynomial<FieldElement, OrderType>* g) {
         size_t reductionsMade = 0;
         for (const auto& f : set) {
             reductionsMade += ReduceWhilePossible(f, g);
@@ -54,8 +58,8 @@ namespace Groebner {
         return reductionsMade > 0;
     }
 
-    template <typename FieldElement, typename OrderType>
-    bool ReduceOverSetWhilePossible(const PolynomialSet<FieldElement, OrderType>& set, Polynomial<FieldElement, OrderType>* g) {
+    template <typename Container, typename FieldElement, typename OrderType>
+    bool ReduceOverSetWhilePossible(const Container& set, Polynomial<FieldElement, OrderType>* g) {
         size_t totalReductions = 0;
         size_t iterationReductions = 0;
         do {
@@ -65,46 +69,143 @@ namespace Groebner {
         return totalReductions > 0;
     }
 
-    template <typename FieldElement, typename OrderType>
-    bool TryReduceSetOverItselfOnce(PolynomialSet<FieldElement, OrderType>* set) {
+    // Same as above, but gives up as soon as the controller asks to stop.
+    template <typename Container, typename FieldElement, typename OrderType>
+    bool ReduceOverSetWhilePossible(const Container& set, Polynomial<FieldElement, OrderType>* g,
+                                    BuhbergerController* controller) {
+        size_t totalReductions = 0;
+        size_t iterationReductions = 0;
+        do {
+            if (controller->shouldStop()) {
+                break;
+            }
+            iterationReductions = TryReduceOverSetOnce(set, g);
+            totalReductions += iterationReductions;
+        } while (iterationReductions > 0);
+        return totalReductions > 0;
+    }
+
+    // Reduces the leading term of g while some element of the set divides it, the tail is left as is.
+    template <typename Container, typename FieldElement, typename OrderType>
+    bool TopReduceOverSetWhilePossible(const Container& set, Polynomial<FieldElement, OrderType>* g,
+                                       BuhbergerController* controller) {
         using Poly = Polynomial<FieldElement, OrderType>;
-        auto it = set->begin();
         size_t reductionsMade = 0;
-        PolynomialSet<FieldElement, OrderType> reducedSet;
-        while (it != set->end()) {
-            Poly p = std::move(set->extract(it++).value());
-            reductionsMade += ReduceOverSetWhilePossible(*set, &p);
-            reductionsMade += ReduceOverSetWhilePossible(reducedSet, &p);
-            if (p != FieldElement(0)) {
-                reducedSet.insert(std::move(p));
+        bool reduced = true;
+        while (reduced && *g != FieldElement(0) && !controller->shouldStop()) {
+            reduced = false;
+            for (const auto& f : set) {
+                const auto& leadingTerm = f.leadingTerm();
+                const auto& gLeadingTerm = g->leadingTerm();
+                if (!Poly::getMonomial(gLeadingTerm).isDivisibleBy(Poly::getMonomial(leadingTerm))) {
+                    continue;
+                }
+                Monomial monomialQuotient = Poly::getMonomial(gLeadingTerm) / Poly::getMonomial(leadingTerm);
+                FieldElement coefficientQuotient = Poly::getCoefficient(gLeadingTerm) / Poly::getCoefficient(leadingTerm);
+                g->subtractMultiple(monomialQuotient, coefficientQuotient, f);
+                ++reductionsMade;
+                reduced = true;
+                break;
             }
         }
-        *set = std::move(reducedSet);
         return reductionsMade > 0;
     }
 
     template <typename FieldElement, typename OrderType>
-    bool ReduceSetOverItselfWhilePossible(PolynomialSet<FieldElement, OrderType>* set) {
+    bool TryReduceSetOverItselfOnce(Basis<FieldElement, OrderType>* basis) {
         using Poly = Polynomial<FieldElement, OrderType>;
+        size_t reductionsMade = 0;
+        for (auto id : basis->getIds()) {
+            basis->modify(id, [&](Poly* p) {
+                reductionsMade += ReduceOverSetWhilePossible(*basis, p);
+            });
+        }
+        return reductionsMade > 0;
+    }
+
+    template <typename FieldElement, typename OrderType>
+    bool ReduceSetOverItselfWhilePossible(Basis<FieldElement, OrderType>* basis) {
         size_t totalReductions = 0;
         size_t iterationReductions = 0;
         do {
-            iterationReductions = TryReduceSetOverItselfOnce(set);
+            iterationReductions = TryReduceSetOverItselfOnce(basis);
             totalReductions += iterationReductions;
         } while (iterationReductions > 0);
         return totalReductions > 0;
     }
 
+    // Same as above, but polls the controller before every element and gives up as soon as it asks to stop.
+    // Elements are only reduced by the others, so an interrupted basis still generates the same ideal.
     template <typename FieldElement, typename OrderType>
-    void LeadingTermToOne(PolynomialSet<FieldElement, OrderType>* set) {
+    bool TryReduceSetOverItselfOnce(Basis<FieldElement, OrderType>* basis, BuhbergerController* controller) {
         using Poly = Polynomial<FieldElement, OrderType>;
+        size_t reductionsMade = 0;
+        for (auto id : basis->getIds()) {
+            if (controller->shouldStop()) {
+                break;
+            }
+            basis->modify(id, [&](Poly* p) {
+                reductionsMade += ReduceOverSetWhilePossible(*basis, p, controller);
+            });
+        }
+        return reductionsMade > 0;
+    }
+
+    template <typename FieldElement, typename OrderType>
+    bool ReduceSetOverItselfWhilePossible(Basis<FieldElement, OrderType>* basis, BuhbergerController* controller) {
+        size_t totalReductions = 0;
+        size_t iterationReductions = 0;
+        do {
+            iterationReductions = TryReduceSetOverItselfOnce(basis, controller);
+            totalReductions += iterationReductions;
+        } while (iterationReductions > 0 && controller->getStatus() == BuhbergerStatus::Completed);
+        return totalReductions > 0;
+    }
+
+    template <typename FieldElement, typename OrderType>
+    bool TryReduceSetOverItselfOnce(PolynomialSet<FieldElement, OrderType>* set) {
+        Basis<FieldElement, OrderType> basis(std::move(*set));
+        bool reduced = TryReduceSetOverItselfOnce(&basis);
+        *set = std::move(basis).toSet();
+        return reduced;
+    }
+
+    template <typename FieldElement, typename OrderType>
+    bool ReduceSetOverItselfWhilePossible(PolynomialSet<FieldElement, OrderType>* set) {
+        Basis<FieldElement, OrderType> basis(std::move(*set));
+        bool reduced = ReduceSetOverItselfWhilePossible(&basis);
+        *set = std::move(basis).toSet();
+        return reduced;
+    }
+
+    template <typename FieldElement, typename OrderType>
+    void LeadingTermToOne(Basis<FieldElement, OrderType>* basis) {
+        basis->normalize();
+    }
+
+    template <typename FieldElement, typename OrderType>
+    void LeadingTermToOne(PolynomialSet<FieldElement, OrderType>* set) {
         PolynomialSet<FieldElement, OrderType> newSet;
-        for (const auto& polynomial : *set) {
-            newSet.insert(polynomial / Poly::getCoefficient(polynomial.leadingTerm()));
+        while (!set->empty()) {
+            auto node = set->extract(set->begin());
+            node.value().normalize();
+            newSet.insert(std::move(node));
         }
         *set = std::move(newSet);
     }
 
+    // Estimated number of bytes taken by the polynomial, counting tree nodes and exponent vectors.
+    template <typename FieldElement, typename OrderType>
+    size_t EstimateMemoryUsage(const Polynomial<FieldElement, OrderType>& p) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        size_t bytes = sizeof(Poly);
+        for (const auto& term : p) {
+            bytes += sizeof(typename Poly::Term) + 4 * sizeof(void*);
+            bytes += Poly::getMonomial(term).greatestVariableIndex() * sizeof(Monomial::DegreeType);
+        }
+        return bytes;
+    }
+
     template <typename FieldElement, typename OrderType>
     bool AreLeadingTermsCoPrime(const Polynomial<FieldElement, OrderType>& f, const Polynomial<FieldElement, OrderType>& g) {
         using Poly = Polynomial<FieldElement, OrderType>;
@@ -116,44 +217,99 @@ namespace Groebner {
     template <typename FieldElement, typename OrderType>
     void ProcessPair(const Polynomial<FieldElement, OrderType>& f,
                      const Polynomial<FieldElement, OrderType>& g,
-                     const PolynomialSet<FieldElement, OrderType>& set,
-                     PolynomialSet<FieldElement, OrderType>* newbies)
+                     const Basis<FieldElement, OrderType>& basis,
+                     std::vector<Polynomial<FieldElement, OrderType>>* newbies,
+                     BuhbergerController* controller)
     {
         if (AreLeadingTermsCoPrime(f, g)) {
             return;
         }
         auto S = S_Polynomial(f, g);
-        ReduceOverSetWhilePossible(set, &S);
-        if (S == FieldElement(0)) {
+        if (controller->getReductionMode() == ReductionMode::TopOnly) {
+            TopReduceOverSetWhilePossible(basis, &S, controller);
+        } else {
+            ReduceOverSetWhilePossible(basis, &S, controller);
+        }
+        if (S == FieldElement(0) || controller->getStatus() != BuhbergerStatus::Completed) {
             return;
         }
-        newbies->insert(std::move(S));
+        if (controller->reserveMemory(EstimateMemoryUsage(S))) {
+            newbies->push_back(std::move(S));
+        }
     }
 
+    // Processes the pairs having at least one element with id not less than firstNewId,
+    // the older ones were processed in the previous rounds.
     template <typename FieldElement, typename OrderType>
-    PolynomialSet<FieldElement, OrderType> GetReducedPairs(const PolynomialSet<FieldElement, OrderType>& set) {
+    std::vector<Polynomial<FieldElement, OrderType>> GetReducedPairs(const Basis<FieldElement, OrderType>& basis,
+                                                                     typename Basis<FieldElement, OrderType>::Id firstNewId,
+                                                                     BuhbergerController* controller) {
         using Poly = Polynomial<FieldElement, OrderType>;
-        PolynomialSet<FieldElement, OrderType> newbies;
-        for (auto it1 = set.begin(); it1 != set.end(); ++it1) {
-            for (auto it2 = set.begin(); it2 != it1; ++it2) {
-                ProcessPair(*it1, *it2, set, &newbies);
+        std::vector<Poly> newbies;
+        auto ids = basis.getIds();
+        auto firstNew = std::lower_bound(ids.begin(), ids.end(), firstNewId);
+        size_t oldCount = firstNew - ids.begin();
+        size_t newCount = ids.end() - firstNew;
+        size_t pairsRemaining = newCount * oldCount + newCount * (newCount - 1) / 2;
+        for (auto it1 = firstNew; it1 != ids.end() && !controller->shouldStop(); ++it1) {
+            for (auto it2 = ids.begin(); it2 != it1 && !controller->shouldStop(); ++it2) {
+                --pairsRemaining;
+                if (controller->isReportingProgress()) {
+                    Monomial lcm12 = lcm(basis.getLeadingMonomial(*it1), basis.getLeadingMonomial(*it2));
+                    controller->reportProgress({basis.size() + newbies.size(), pairsRemaining, lcm12.totalDegree()});
+                }
+                ProcessPair(basis[*it1], basis[*it2], basis, &newbies, controller);
             }
         }
-        LeadingTermToOne(&newbies);
+        for (auto& p : newbies) {
+            p.normalize();
+        }
         return newbies;
     }
 
+    // Returns the reason of abort, leaving in the basis the elements computed so far, which generate the same ideal.
     template <typename FieldElement, typename OrderType>
-    void DoBuhberger(PolynomialSet<FieldElement, OrderType>* set) {
-        using Poly = Polynomial<FieldElement, OrderType>;
-        ReduceSetOverItselfWhilePossible(set);
-        LeadingTermToOne(set);
-        PolynomialSet<FieldElement, OrderType> newbies = GetReducedPairs(*set);
+    BuhbergerStatus DoBuhberger(Basis<FieldElement, OrderType>* basis,
+                                const BuhbergerOptions& options = BuhbergerOptions()) {
+        BuhbergerController controller(options);
+        ReduceSetOverItselfWhilePossible(basis, &controller);
+        LeadingTermToOne(basis);
+        if (controller.getStatus() != BuhbergerStatus::Completed) {
+            return controller.getStatus();
+        }
+        for (const auto& p : *basis) {
+            if (!controller.reserveMemory(EstimateMemoryUsage(p))) {
+                return controller.getStatus();
+            }
+        }
+        auto newbies = GetReducedPairs(*basis, 0, &controller);
         while (!newbies.empty()) {
-            std::move(newbies.begin(), newbies.end(), std::inserter(*set, set->begin()));
-            newbies = GetReducedPairs(*set);
+            auto firstNewId = basis->getIdsBound();
+            for (auto& p : newbies) {
+                if (basis->find(p) == Basis<FieldElement, OrderType>::NoId) {
+                    basis->insert(std::move(p));
+                }
+            }
+            if (controller.getStatus() != BuhbergerStatus::Completed) {
+                return controller.getStatus();
+            }
+            newbies = GetReducedPairs(*basis, firstNewId, &controller);
         }
-        ReduceSetOverItselfWhilePossible(set);
+        if (controller.getStatus() != BuhbergerStatus::Completed) {
+            return controller.getStatus();
+        }
+        ReduceSetOverItselfWhilePossible(basis, &controller);
+        LeadingTermToOne(basis);
+        return controller.getStatus();
+    }
+
+    template <typename FieldElement, typename OrderType>
+    BuhbergerStatus DoBuhberger(PolynomialSet<FieldElement, OrderType>* set,
+                                const BuhbergerOptions& options = BuhbergerOptions()) {
+        Basis<FieldElement, OrderType> basis(std::move(*set));
+        auto status = DoBuhberger(&basis, options);
+        *set = std::move(basis).toSet();
+        return status;
     }
 
     template <typename FieldElement, typename OrderType>
@@ -185,6 +341,43 @@ namespace Groebner {
         return Polynomial<FieldElement, OrderType>(Monomial::getNthVariable(maxVariableNumber));
     }
 
+    template <typename NewOrderType, typename FieldElement, typename OrderType>
+    Polynomial<FieldElement, NewOrderType> ChangeOrder(const Polynomial<FieldElement, OrderType>& p) {
+        return Polynomial<FieldElement, NewOrderType>(p.begin(), p.end());
+    }
+
+    template <typename NewOrderType, typename FieldElement, typename OrderType>
+    PolynomialSet<FieldElement, NewOrderType> ChangeOrder(const PolynomialSet<FieldElement, OrderType>& set) {
+        PolynomialSet<FieldElement, NewOrderType> result;
+        for (const auto& p : set) {
+            result.insert(ChangeOrder<NewOrderType>(p));
+        }
+        return result;
+    }
+
+    // Replaces every variable with index i by the variable with index newIndices[i].
+    template <typename FieldElement, typename OrderType>
+    Polynomial<FieldElement, OrderType> RenameVariables(const Polynomial<FieldElement, OrderType>& p,
+                                                        const std::vector<size_t>& newIndices) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        if (GetMaxVariableNumber(p) > newIndices.size()) {
+            throw std::runtime_error("Not all variables are renamed.");
+        }
+        std::vector<typename Poly::Term> terms;
+        for (const auto& term : p) {
+            const auto& monomial = Poly::getMonomial(term);
+            Monomial::DegreeContainer degrees;
+            for (size_t variableIndex = 0; variableIndex < monomial.greatestVariableIndex(); ++variableIndex) {
+                if (monomial.degree(variableIndex) > 0) {
+                    degrees.resize(std::max(degrees.size(), newIndices[variableIndex] + 1));
+                    degrees[newIndices[variableIndex]] += monomial.degree(variableIndex);
+                }
+            }
+            terms.emplace_back(Monomial(std::move(degrees)), Poly::getCoefficient(term));
+        }
+        return Poly(terms.begin(), terms.end());
+    }
+
     template <typename FieldElement, typename OrderType>
     bool LaysInRadical(PolynomialSet<FieldElement, OrderType> ideal, Polynomial<FieldElement, OrderType> p) {
         Polynomial<FieldElement, OrderType> one({{Monomial(), 1}});
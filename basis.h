@@ -0,0 +1,250 @@
+#ifndef GROEBNER_BASIS_H
+#define GROEBNER_BASIS_H
+
+#include "polynomial.h"
+#include <iterator>
+#include <limits>
+
+namespace Groebner {
+    // Polynomials with stable integer ids, indexed by leading monomial.
+    // Leading monomials and coefficients are available by id without walking the polynomial.
+    // Iteration goes in increasing order of leading monomials, which is canonical for reduced bases.
+    template <typename FieldElement, typename OrderType>
+    class Basis {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        using Index = std::multimap<Monomial, size_t, OrderAdaptor<OrderType>>;
+     public:
+        using Id = size_t;
+        static constexpr Id NoId = std::numeric_limits<Id>::max();
+
+        class const_iterator {
+         public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Poly;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Poly*;
+            using reference = const Poly&;
+
+            const_iterator(typename Index::const_iterator position, const Basis* basis)
+                : position(position), basis(basis) {}
+
+            reference operator*() const {
+                return (*basis)[id()];
+            }
+
+            pointer operator->() const {
+                return &(*basis)[id()];
+            }
+
+            const_iterator& operator++() {
+                ++position;
+                return *this;
+            }
+
+            const_iterator operator++(int) {
+                const_iterator old = *this;
+                ++position;
+                return old;
+            }
+
+            Id id() const {
+                return position->second;
+            }
+
+            friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) {
+                return lhs.position == rhs.position;
+            }
+
+            friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) {
+                return !(lhs == rhs);
+            }
+         private:
+            typename Index::const_iterator position;
+            const Basis* basis;
+        };
+
+        Basis() = default;
+
+        explicit Basis(PolynomialSet<FieldElement, OrderType> set) {
+            while (!set.empty()) {
+                insert(std::move(set.extract(set.begin()).value()));
+            }
+        }
+
+        // Zero polynomials are not stored, but still get an id.
+        Id insert(Poly p) {
+            Id id = entries.size();
+            entries.push_back({Poly(), false});
+            replace(id, std::move(p));
+            return id;
+        }
+
+        // Returns the id of an element equal to p, or NoId.
+        Id find(const Poly& p) const {
+            if (p == FieldElement(0)) {
+                return NoId;
+            }
+            auto range = index.equal_range(Poly::getMonomial(p.leadingTerm()));
+            for (auto it = range.first; it != range.second; ++it) {
+                if (entries[it->second].polynomial == p) {
+                    return it->second;
+                }
+            }
+            return NoId;
+        }
+
+        bool contains(Id id) const {
+            return id < entries.size() && entries[id].alive;
+        }
+
+        // Takes the element out of the basis, its id stays reserved for replace.
+        Poly extract(Id id) {
+            auto& entry = entries[id];
+            if (entry.alive) {
+                unindex(id);
+            }
+            return std::move(entry.polynomial);
+        }
+
+        // Puts a polynomial at the given id, a zero polynomial leaves the id empty.
+        void replace(Id id, Poly p) {
+            auto& entry = entries[id];
+            if (entry.alive) {
+                unindex(id);
+            }
+            entry.polynomial = std::move(p);
+            if (entry.polynomial == FieldElement(0)) {
+                return;
+            }
+            index.emplace(Poly::getMonomial(entry.polynomial.leadingTerm()), id);
+            entry.alive = true;
+        }
+
+        void erase(Id id) {
+            extract(id);
+        }
+
+        // Applies the mutator to the element in place, keeping the index up to date.
+        template <typename Mutator>
+        void modify(Id id, Mutator mutator) {
+            Poly p = extract(id);
+            mutator(&p);
+            replace(id, std::move(p));
+        }
+
+        const Poly& operator[](Id id) const {
+            return entries[id].polynomial;
+        }
+
+        const Monomial& getLeadingMonomial(Id id) const {
+            return Poly::getMonomial(entries[id].polynomial.leadingTerm());
+        }
+
+        const FieldElement& getLeadingCoefficient(Id id) const {
+            return Poly::getCoefficient(entries[id].polynomial.leadingTerm());
+        }
+
+        // Live ids in increasing order.
+        std::vector<Id> getIds() const {
+            std::vector<Id> ids;
+            for (Id id = 0; id < entries.size(); ++id) {
+                if (contains(id)) {
+                    ids.push_back(id);
+                }
+            }
+            return ids;
+        }
+
+        Id getIdsBound() const {
+            return entries.size();
+        }
+
+        size_t size() const {
+            return index.size();
+        }
+
+        bool empty() const {
+            return index.empty();
+        }
+
+        const_iterator begin() const {
+            return const_iterator(index.begin(), this);
+        }
+
+        const_iterator end() const {
+            return const_iterator(index.end(), this);
+        }
+
+        // Makes every leading coefficient equal to one without moving the elements.
+        void normalize() {
+            for (const auto& position : index) {
+                entries[position.second].polynomial.normalize();
+            }
+        }
+
+        PolynomialSet<FieldElement, OrderType> toSet() && {
+            PolynomialSet<FieldElement, OrderType> set;
+            for (const auto& position : index) {
+                set.insert(std::move(entries[position.second].polynomial));
+            }
+            entries.clear();
+            index.clear();
+            return set;
+        }
+
+        // Compares elements in the order of leading monomials, which is enough for reduced bases.
+        friend bool operator==(const Basis& lhs, const Basis& rhs) {
+            return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+        friend bool operator!=(const Basis& lhs, const Basis& rhs) {
+            return !(lhs == rhs);
+        }
+     private:
+        struct Entry {
+            Poly polynomial;
+            bool alive;
+        };
+
+        std::vector<Entry> entries;
+        Index index;
+
+        void unindex(Id id) {
+            auto range = index.equal_range(getLeadingMonomial(id));
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second == id) {
+                    index.erase(it);
+                    break;
+                }
+            }
+            entries[id].alive = false;
+        }
+    };
+
+    // Canonical comparison of two reduced bases with normalized leading coefficients:
+    // elements are matched by leading monomial, so no polynomial is hashed.
+    template <typename FieldElement, typename OrderType>
+    bool AreEqualBases(const PolynomialSet<FieldElement, OrderType>& lhs, const PolynomialSet<FieldElement, OrderType>& rhs) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        auto sortByLeadingMonomial = [](const PolynomialSet<FieldElement, OrderType>& set) {
+            std::vector<const Poly*> sorted;
+            for (const auto& p : set) {
+                sorted.push_back(&p);
+            }
+            std::sort(sorted.begin(), sorted.end(), [](const Poly* first, const Poly* second) {
+                return OrderType::isLess(Poly::getMonomial(first->leadingTerm()), Poly::getMonomial(second->leadingTerm()));
+            });
+            return sorted;
+        };
+        auto lhsSorted = sortByLeadingMonomial(lhs);
+        auto rhsSorted = sortByLeadingMonomial(rhs);
+        return std::equal(lhsSorted.begin(), lhsSorted.end(), rhsSorted.begin(), [](const Poly* first, const Poly* second) {
+            return *first == *second;
+        });
+    }
+}
+
+#endif //GROEBNER_BASIS_H
@@ -0,0 +1,216 @@
+#include "batch.h"
+#include "algorithm.h"
+#include "parser.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+namespace Groebner {
+    namespace {
+        using Rational = boost::rational<long long>;
+
+        // Jobs submitted ahead of the results per pool thread, enough to keep every thread busy.
+        constexpr size_t BatchJobsInFlightPerThread = 4;
+
+        std::string trim(const std::string& s) {
+            size_t first = s.find_first_not_of(" \t\r\n");
+            if (first == std::string::npos) {
+                return "";
+            }
+            size_t last = s.find_last_not_of(" \t\r\n");
+            return s.substr(first, last - first + 1);
+        }
+
+        template <typename FieldElement, typename OrderType>
+        std::vector<std::string> Solve(const std::vector<std::string>& generators) {
+            using Poly = Polynomial<FieldElement, OrderType>;
+            PolynomialSet<FieldElement, OrderType> ideal;
+            for (const auto& generator : generators) {
+                ideal.insert(ParsePolynomial<FieldElement, OrderType>(generator));
+            }
+            DoBuhberger(&ideal);
+            LeadingTermToOne(&ideal);
+            std::vector<const Poly*> sorted;
+            for (const auto& p : ideal) {
+                sorted.push_back(&p);
+            }
+            std::sort(sorted.begin(), sorted.end(), [](const Poly* lhs, const Poly* rhs) {
+                return OrderType::isLess(Poly::getMonomial(lhs->leadingTerm()), Poly::getMonomial(rhs->leadingTerm()));
+            });
+            std::vector<std::string> basis;
+            for (const Poly* p : sorted) {
+                std::ostringstream os;
+                os << *p;
+                basis.push_back(os.str());
+            }
+            return basis;
+        }
+
+        template <typename FieldElement>
+        std::vector<std::string> SolveWithOrder(const std::string& order, const std::vector<std::string>& generators) {
+            if (order == "lex") {
+                return Solve<FieldElement, LexOrder>(generators);
+            }
+            if (order == "deglex") {
+                return Solve<FieldElement, DegreeLexOrder>(generators);
+            }
+            if (order == "degrevlex") {
+                return Solve<FieldElement, DegreeRevLexOrder>(generators);
+            }
+            throw std::runtime_error("Unknown order \"" + order + "\".");
+        }
+
+        const char* const BatchUsage = "Usage: main --batch [--threads N] [--completion-order]";
+
+        bool ParseThreadsCount(const std::string& arg, size_t* threadsCount) {
+            if (arg.empty() || !std::all_of(arg.begin(), arg.end(), [](unsigned char c) { return std::isdigit(c); })) {
+                return false;
+            }
+            try {
+                *threadsCount = std::stoul(arg);
+            } catch (const std::out_of_range&) {
+                return false;
+            }
+            return true;
+        }
+    }
+
+    BatchJob ParseBatchJob(const std::string& line) {
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) {
+            throw std::runtime_error("Job should look like \"<order> <coefficients>: <generators>\".");
+        }
+        BatchJob job;
+        std::istringstream header(line.substr(0, colon));
+        header >> job.order >> job.coefficients;
+        std::istringstream generators(line.substr(colon + 1));
+        std::string generator;
+        while (std::getline(generators, generator, ',')) {
+            generator = trim(generator);
+            if (!generator.empty()) {
+                job.generators.push_back(generator);
+            }
+        }
+        return job;
+    }
+
+    BatchResult SolveBatchJob(size_t index, const BatchJob& job) {
+        BatchResult result{index, {}, {}};
+        try {
+            if (!job.error.empty()) {
+                throw std::runtime_error(job.error);
+            }
+            if (job.order.empty()) {
+                throw std::runtime_error("Job should look like \"<order> <coefficients>: <generators>\".");
+            }
+            if (job.coefficients != "rational") {
+                throw std::runtime_error("Unknown coefficients \"" + job.coefficients + "\".");
+            }
+            result.basis = SolveWithOrder<Rational>(job.order, job.generators);
+        } catch (const std::exception& e) {
+            result.error = e.what();
+        }
+        return result;
+    }
+
+    void SolveBatch(const std::function<bool(BatchJob*)>& source,
+                    const std::function<void(const BatchResult&)>& sink,
+                    ResultOrder resultOrder,
+                    size_t threadsCount) {
+        std::mutex mutex;
+        std::condition_variable delivered;
+        std::map<size_t, BatchResult> finishedResults;
+        size_t nextResultIndex = 0;
+        // A job is in flight from its submission until its result is passed to the sink, so the queued jobs
+        // and the results held back for the submission order are bounded together.
+        size_t jobsInFlight = 0;
+        auto deliver = [&](BatchResult result) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (resultOrder == ResultOrder::Completion) {
+                sink(result);
+                --jobsInFlight;
+            } else {
+                finishedResults.emplace(result.index, std::move(result));
+                while (!finishedResults.empty() && finishedResults.begin()->first == nextResultIndex) {
+                    sink(finishedResults.begin()->second);
+                    finishedResults.erase(finishedResults.begin());
+                    ++nextResultIndex;
+                    --jobsInFlight;
+                }
+            }
+            delivered.notify_all();
+        };
+
+        ThreadPool pool(threadsCount == 0 ? std::thread::hardware_concurrency() : threadsCount);
+        const size_t maxJobsInFlight = BatchJobsInFlightPerThread * pool.size();
+        BatchJob job;
+        for (size_t index = 0; source(&job); ++index) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                delivered.wait(lock, [&] { return jobsInFlight < maxJobsInFlight; });
+                ++jobsInFlight;
+            }
+            pool.submit([&deliver, index, job = std::move(job)] {
+                deliver(SolveBatchJob(index, job));
+            });
+            job = BatchJob();
+        }
+        pool.wait();
+    }
+
+    int RunBatchDriver(int argc, char** argv, std::istream& input, std::ostream& output) {
+        size_t threadsCount = 0;
+        ResultOrder resultOrder = ResultOrder::Submission;
+        for (int argIndex = 1; argIndex < argc; ++argIndex) {
+            std::string arg = argv[argIndex];
+            if (arg == "--threads") {
+                if (argIndex + 1 == argc || !ParseThreadsCount(argv[++argIndex], &threadsCount)) {
+                    std::cerr << "--threads should be followed by a number\n" << BatchUsage << std::endl;
+                    return 1;
+                }
+            } else if (arg == "--completion-order") {
+                resultOrder = ResultOrder::Completion;
+            } else if (arg != "--batch") {
+                std::cerr << "Unknown argument " << arg << "\n" << BatchUsage << std::endl;
+                return 1;
+            }
+        }
+
+        bool failed = false;
+        auto source = [&](BatchJob* job) {
+            std::string line;
+            while (std::getline(input, line)) {
+                line = trim(line);
+                if (line.empty() || line[0] == '#') {
+                    continue;
+                }
+                try {
+                    *job = ParseBatchJob(line);
+                } catch (const std::exception& e) {
+                    *job = BatchJob();
+                    job->error = e.what();
+                }
+                return true;
+            }
+            return false;
+        };
+        auto sink = [&](const BatchResult& result) {
+            output << result.index << ":";
+            if (!result.error.empty()) {
+                failed = true;
+                output << " error: " << result.error;
+            }
+            for (size_t i = 0; i < result.basis.size(); ++i) {
+                output << (i == 0 ? " " : ", ") << result.basis[i];
+            }
+            output << "\n";
+        };
+        SolveBatch(source, sink, resultOrder, threadsCount);
+        output.flush();
+        return failed ? 1 : 0;
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef GROEBNER_BATCH_H
+#define GROEBNER_BATCH_H
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace Groebner {
+    // One ideal of a batch: order is "lex", "deglex" or "degrevlex", coefficients are "rational".
+    struct BatchJob {
+        std::string order;
+        std::string coefficients;
+        std::vector<std::string> generators;
+        // Set when the job could not be parsed, it becomes the error of the job's result.
+        std::string error;
+    };
+
+    struct BatchResult {
+        size_t index;
+        std::vector<std::string> basis;
+        std::string error;
+    };
+
+    enum class ResultOrder {
+        Submission,
+        Completion
+    };
+
+    // Parses a line of the form "<order> <coefficients>: <generator>, <generator>, ...".
+    BatchJob ParseBatchJob(const std::string& line);
+
+    // Computes the reduced basis of the job, reporting malformed input in the error field.
+    BatchResult SolveBatchJob(size_t index, const BatchJob& job);
+
+    // Solves every job read from the source on a thread pool and passes the results to the sink,
+    // either in the order of jobs or as soon as each one is finished. The sink is never called concurrently.
+    // Each job is parsed and solved entirely on one worker, so its allocations stay in that thread's arena.
+    // The source is read only a few jobs per thread ahead of the sink, so a long batch is not held in memory.
+    void SolveBatch(const std::function<bool(BatchJob*)>& source,
+                    const std::function<void(const BatchResult&)>& sink,
+                    ResultOrder resultOrder = ResultOrder::Submission,
+                    size_t threadsCount = 0);
+
+    // Command-line driver: reads one job per line from the input and writes "<index>: <basis>" lines.
+    // Recognized arguments are "--threads N" and "--completion-order".
+    int RunBatchDriver(int argc, char** argv, std::istream& input, std::ostream& output);
+}
+
+#endif //GROEBNER_BATCH_H
@@ -0,0 +1,86 @@
+#include "control.h"
+
+namespace Groebner {
+    void CancellationToken::cancel() {
+        cancelled.store(true, std::memory_order_relaxed);
+    }
+
+    bool CancellationToken::isCancelled() const {
+        return cancelled.load(std::memory_order_relaxed);
+    }
+
+    MemoryBudget::MemoryBudget(size_t limit) : limit(limit) {}
+
+    bool MemoryBudget::tryReserve(size_t bytes) {
+        size_t current = used.load(std::memory_order_relaxed);
+        do {
+            if (current + bytes > limit) {
+                return false;
+            }
+        } while (!used.compare_exchange_weak(current, current + bytes, std::memory_order_relaxed));
+        return true;
+    }
+
+    void MemoryBudget::release(size_t bytes) {
+        used.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    size_t MemoryBudget::getUsed() const {
+        return used.load(std::memory_order_relaxed);
+    }
+
+    size_t MemoryBudget::getLimit() const {
+        return limit;
+    }
+
+    BuhbergerController::BuhbergerController(const BuhbergerOptions& options) : options(options) {}
+
+    BuhbergerController::~BuhbergerController() {
+        if (options.memoryBudget != nullptr) {
+            options.memoryBudget->release(reservedMemory);
+        }
+    }
+
+    bool BuhbergerController::shouldStop() {
+        if (status != BuhbergerStatus::Completed) {
+            return true;
+        }
+        if (options.cancellationToken != nullptr && options.cancellationToken->isCancelled()) {
+            status = BuhbergerStatus::Cancelled;
+        } else if (options.deadline != std::chrono::steady_clock::time_point::max()
+                   && std::chrono::steady_clock::now() >= options.deadline) {
+            status = BuhbergerStatus::DeadlineExceeded;
+        }
+        return status != BuhbergerStatus::Completed;
+    }
+
+    bool BuhbergerController::reserveMemory(size_t bytes) {
+        if (options.memoryBudget == nullptr) {
+            return true;
+        }
+        if (!options.memoryBudget->tryReserve(bytes)) {
+            status = BuhbergerStatus::MemoryBudgetExceeded;
+            return false;
+        }
+        reservedMemory += bytes;
+        return true;
+    }
+
+    bool BuhbergerController::isReportingProgress() const {
+        return static_cast<bool>(options.progressCallback);
+    }
+
+    void BuhbergerController::reportProgress(const BuhbergerProgress& progress) const {
+        if (options.progressCallback) {
+            options.progressCallback(progress);
+        }
+    }
+
+    BuhbergerStatus BuhbergerController::getStatus() const {
+        return status;
+    }
+
+    ReductionMode BuhbergerController::getReductionMode() const {
+        return options.reductionMode;
+    }
+}
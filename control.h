@@ -0,0 +1,88 @@
+#ifndef GROEBNER_CONTROL_H
+#define GROEBNER_CONTROL_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <string>
+
+namespace Groebner {
+    class CancellationToken {
+     public:
+        void cancel();
+        bool isCancelled() const;
+     private:
+        std::atomic<bool> cancelled{false};
+    };
+
+    // Limit in bytes on the estimated memory of the computations using it, may be shared between threads.
+    class MemoryBudget {
+     public:
+        explicit MemoryBudget(size_t limit);
+        bool tryReserve(size_t bytes);
+        void release(size_t bytes);
+        size_t getUsed() const;
+        size_t getLimit() const;
+     private:
+        std::atomic<size_t> used{0};
+        size_t limit;
+    };
+
+    struct BuhbergerProgress {
+        size_t basisSize;
+        size_t pairsRemaining;
+        size_t currentDegree;
+    };
+
+    enum class BuhbergerStatus {
+        Completed,
+        DeadlineExceeded,
+        Cancelled,
+        MemoryBudgetExceeded
+    };
+
+    // Full reduces every term of an S-polynomial against the intermediate basis, TopOnly reduces
+    // only its leading term and leaves the tails to the final interreduction.
+    enum class ReductionMode {
+        Full,
+        TopOnly
+    };
+
+    struct BuhbergerOptions {
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+        const CancellationToken* cancellationToken = nullptr;
+        std::function<void(const BuhbergerProgress&)> progressCallback;
+        MemoryBudget* memoryBudget = nullptr;
+        ReductionMode reductionMode = ReductionMode::Full;
+        // Resident bytes of basis elements, and separately of queued pairs, above which DoOutOfCoreBuhberger
+        // moves the least recently used ones to a spill file. Directory of the file, the temporary one if empty.
+        size_t spillThreshold = std::numeric_limits<size_t>::max();
+        std::string spillDirectory;
+    };
+
+    // Tracks a single computation against its options. Reserved memory is released on destruction.
+    class BuhbergerController {
+     public:
+        explicit BuhbergerController(const BuhbergerOptions& options);
+        BuhbergerController(const BuhbergerController&) = delete;
+        BuhbergerController& operator=(const BuhbergerController&) = delete;
+        ~BuhbergerController();
+
+        // Polls the deadline and the cancellation token, returns true if the computation should be aborted.
+        bool shouldStop();
+        bool reserveMemory(size_t bytes);
+        // Lets the caller skip computing a progress report nobody receives.
+        bool isReportingProgress() const;
+        void reportProgress(const BuhbergerProgress& progress) const;
+        BuhbergerStatus getStatus() const;
+        ReductionMode getReductionMode() const;
+     private:
+        const BuhbergerOptions& options;
+        BuhbergerStatus status = BuhbergerStatus::Completed;
+        size_t reservedMemory = 0;
+    };
+}
+
+#endif //GROEBNER_CONTROL_H
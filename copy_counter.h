@@ -0,0 +1,79 @@
+#ifndef GROEBNER_COPY_COUNTER_H
+#define GROEBNER_COPY_COUNTER_H
+
+#include <atomic>
+#include <cstddef>
+
+namespace Groebner {
+    // Counts constructions, assignments and destructions of the derived class T. The counters are atomic
+    // and shared by all threads, so operations made on pool workers are counted without a data race.
+    template <typename T>
+    class CopyCounter {
+     public:
+        CopyCounter() {
+            getCounters().defaultConstructors.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        CopyCounter(const CopyCounter&) {
+            getCounters().copyConstructors.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        CopyCounter(CopyCounter&&) noexcept {
+            getCounters().moveConstructors.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        CopyCounter& operator=(const CopyCounter&) {
+            getCounters().copyAssignments.fetch_add(1, std::memory_order_relaxed);
+            return *this;
+        }
+
+        CopyCounter& operator=(CopyCounter&&) noexcept {
+            getCounters().moveAssignments.fetch_add(1, std::memory_order_relaxed);
+            return *this;
+        }
+
+        ~CopyCounter() {
+            getCounters().destructors.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        static size_t countDefaultCTors() {
+            return getCounters().defaultConstructors.load(std::memory_order_relaxed);
+        }
+
+        static size_t countCopyCTors() {
+            return getCounters().copyConstructors.load(std::memory_order_relaxed);
+        }
+
+        static size_t countMoveCTors() {
+            return getCounters().moveConstructors.load(std::memory_order_relaxed);
+        }
+
+        static size_t countCopyAsgnmts() {
+            return getCounters().copyAssignments.load(std::memory_order_relaxed);
+        }
+
+        static size_t countMoveAsgnmts() {
+            return getCounters().moveAssignments.load(std::memory_order_relaxed);
+        }
+
+        static size_t countDestructors() {
+            return getCounters().destructors.load(std::memory_order_relaxed);
+        }
+     private:
+        struct Counters {
+            std::atomic<size_t> defaultConstructors{0};
+            std::atomic<size_t> copyConstructors{0};
+            std::atomic<size_t> moveConstructors{0};
+            std::atomic<size_t> copyAssignments{0};
+            std::atomic<size_t> moveAssignments{0};
+            std::atomic<size_t> destructors{0};
+        };
+
+        static Counters& getCounters() {
+            static Counters counters;
+            return counters;
+        }
+    };
+}
+
+#endif //GROEBNER_COPY_COUNTER_H
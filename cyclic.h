@@ -2,6 +2,7 @@
 #define GROEBNER_CYCLIC_H
 
 #include "polynomial.h"
+#include "multiplication.h"
 
 using Rational = boost::rational<long long>;
 
@@ -28,10 +29,11 @@ RationalPolynomialVector<OrderType> GeneratePowerFamily(size_t n) {
 template <typename OrderType>
 RationalPolynomialVector<OrderType> GenerateSymmetricFamily(const RationalPolynomialVector<OrderType>& powerFamily) {
     RationalPolynomialVector<OrderType> symmetricFamily(powerFamily.size());
+    std::unique_ptr<Groebner::ThreadPool> pool;
     symmetricFamily[0] = Rational(1);
     for (size_t k = 1; k < symmetricFamily.size(); ++k) {
         for (size_t i = 1; i <= k; ++i) {
-            auto summand = symmetricFamily[k - i] * powerFamily[i];
+            auto summand = Groebner::Multiply(symmetricFamily[k - i], powerFamily[i], &pool);
             if (i % 2 == 1) {
                 symmetricFamily[k] += summand;
             } else {
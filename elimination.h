@@ -0,0 +1,155 @@
+#ifndef GROEBNER_ELIMINATION_H
+#define GROEBNER_ELIMINATION_H
+
+#include "algorithm.h"
+#include <algorithm>
+#include <set>
+
+namespace Groebner {
+    template <typename FieldElement, typename OrderType>
+    bool DependsOnFirstVariables(const Polynomial<FieldElement, OrderType>& p, size_t variablesCount) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        return std::any_of(p.begin(), p.end(), [&](const typename Poly::Term& term) {
+            for (size_t variableIndex = 0; variableIndex < variablesCount; ++variableIndex) {
+                if (Poly::getMonomial(term).degree(variableIndex) > 0) {
+                    return true;
+                }
+            }
+            return false;
+        });
+    }
+
+    // Returns the reduced DegRevLex basis of the ideal intersected with k[x_EliminatedCount, x_EliminatedCount+1, ...].
+    // On polynomials free of the first block BlockOrder coincides with DegRevLex, so the filtered basis stays reduced.
+    template <size_t EliminatedCount, typename FieldElement, typename OrderType>
+    PolynomialSet<FieldElement, DegreeRevLexOrder> EliminateFirstVariables(const PolynomialSet<FieldElement, OrderType>& ideal) {
+        auto basis = ChangeOrder<BlockOrder<EliminatedCount>>(ideal);
+        DoBuhberger(&basis);
+        LeadingTermToOne(&basis);
+        PolynomialSet<FieldElement, DegreeRevLexOrder> result;
+        for (const auto& p : basis) {
+            if (!DependsOnFirstVariables(p, EliminatedCount)) {
+                result.insert(ChangeOrder<DegreeRevLexOrder>(p));
+            }
+        }
+        return result;
+    }
+
+    template <typename FieldElement, typename OrderType>
+    size_t GetVariablesCount(const PolynomialSet<FieldElement, OrderType>& ideal) {
+        size_t variablesCount = 0;
+        for (const auto& p : ideal) {
+            variablesCount = std::max(variablesCount, GetMaxVariableNumber(p));
+        }
+        return variablesCount;
+    }
+
+    template <typename FieldElement, typename OrderType>
+    PolynomialSet<FieldElement, OrderType> RenameVariables(const PolynomialSet<FieldElement, OrderType>& ideal,
+                                                           const std::vector<size_t>& newIndices) {
+        PolynomialSet<FieldElement, OrderType> result;
+        for (const auto& p : ideal) {
+            result.insert(RenameVariables(p, newIndices));
+        }
+        return result;
+    }
+
+    // Moves the variable with the given index to the front, keeping the relative order of the others.
+    inline std::vector<size_t> GetMoveToFrontIndices(size_t variableIndex, size_t variablesCount) {
+        std::vector<size_t> newIndices(std::max(variablesCount, variableIndex + 1));
+        for (size_t index = 0; index < newIndices.size(); ++index) {
+            newIndices[index] = (index < variableIndex ? index + 1 : index);
+        }
+        newIndices[variableIndex] = 0;
+        return newIndices;
+    }
+
+    inline std::vector<size_t> GetInverseIndices(const std::vector<size_t>& newIndices) {
+        std::vector<size_t> inverseIndices(newIndices.size());
+        for (size_t index = 0; index < newIndices.size(); ++index) {
+            inverseIndices[newIndices[index]] = index;
+        }
+        return inverseIndices;
+    }
+
+    // Moves the given variables to the front and the others after them, keeping the relative order in both groups.
+    inline std::vector<size_t> GetMoveToFrontIndices(const std::vector<size_t>& variables, size_t variablesCount) {
+        std::vector<bool> isMoved(variablesCount);
+        for (size_t variableIndex : variables) {
+            isMoved[variableIndex] = true;
+        }
+        std::vector<size_t> newIndices(variablesCount);
+        size_t movedCount = std::count(isMoved.begin(), isMoved.end(), true);
+        size_t movedIndex = 0;
+        size_t keptIndex = movedCount;
+        for (size_t index = 0; index < variablesCount; ++index) {
+            newIndices[index] = (isMoved[index] ? movedIndex++ : keptIndex++);
+        }
+        return newIndices;
+    }
+
+    // Returns the reduced DegRevLex basis of the ideal intersected with the ring without the given variables.
+    // The variables are moved to the front and eliminated together by a single run in RuntimeBlockOrder.
+    // Its block size is known only at run time and is set for this thread, so the polynomials in that order
+    // stay local to this function: the run is on the calling thread and the result is converted to DegRevLex.
+    template <typename FieldElement, typename OrderType>
+    PolynomialSet<FieldElement, DegreeRevLexOrder> EliminateVariables(const PolynomialSet<FieldElement, OrderType>& ideal,
+                                                                      const std::vector<size_t>& variables) {
+        size_t variablesCount = GetVariablesCount(ideal);
+        for (size_t variableIndex : variables) {
+            variablesCount = std::max(variablesCount, variableIndex + 1);
+        }
+        auto newIndices = GetMoveToFrontIndices(variables, variablesCount);
+        auto inverseIndices = GetInverseIndices(newIndices);
+        size_t eliminatedCount = std::set<size_t>(variables.begin(), variables.end()).size();
+        BlockSizeScope scope(eliminatedCount);
+        auto basis = ChangeOrder<RuntimeBlockOrder>(RenameVariables(ideal, newIndices));
+        DoBuhberger(&basis);
+        LeadingTermToOne(&basis);
+        PolynomialSet<FieldElement, DegreeRevLexOrder> result;
+        for (const auto& p : basis) {
+            if (!DependsOnFirstVariables(p, eliminatedCount)) {
+                result.insert(RenameVariables(ChangeOrder<DegreeRevLexOrder>(p), inverseIndices));
+            }
+        }
+        return result;
+    }
+
+    // Computes the intersection as (tI + (1 - t)J) intersected with k[x], t being a new first variable.
+    template <typename FieldElement, typename OrderType>
+    PolynomialSet<FieldElement, DegreeRevLexOrder> IntersectIdeals(const PolynomialSet<FieldElement, OrderType>& first,
+                                                                   const PolynomialSet<FieldElement, OrderType>& second) {
+        using Poly = Polynomial<FieldElement, DegreeRevLexOrder>;
+        size_t variablesCount = std::max(GetVariablesCount(first), GetVariablesCount(second));
+        auto newIndices = GetMoveToFrontIndices(variablesCount, variablesCount);
+        Poly t(Monomial::getNthVariable(0));
+        Poly one(FieldElement(1));
+        PolynomialSet<FieldElement, DegreeRevLexOrder> ideal;
+        for (const auto& p : first) {
+            ideal.insert(t * RenameVariables(ChangeOrder<DegreeRevLexOrder>(p), newIndices));
+        }
+        for (const auto& p : second) {
+            ideal.insert((one - t) * RenameVariables(ChangeOrder<DegreeRevLexOrder>(p), newIndices));
+        }
+        return RenameVariables(EliminateFirstVariables<1>(ideal), GetInverseIndices(newIndices));
+    }
+
+    // Computes the saturation I : f^inf as (I + (1 - tf)) intersected with k[x], t being a new first variable.
+    template <typename FieldElement, typename OrderType>
+    PolynomialSet<FieldElement, DegreeRevLexOrder> Saturate(const PolynomialSet<FieldElement, OrderType>& ideal,
+                                                            const Polynomial<FieldElement, OrderType>& f) {
+        using Poly = Polynomial<FieldElement, DegreeRevLexOrder>;
+        size_t variablesCount = std::max(GetVariablesCount(ideal), GetMaxVariableNumber(f));
+        auto newIndices = GetMoveToFrontIndices(variablesCount, variablesCount);
+        Poly t(Monomial::getNthVariable(0));
+        Poly one(FieldElement(1));
+        PolynomialSet<FieldElement, DegreeRevLexOrder> extendedIdeal;
+        for (const auto& p : ideal) {
+            extendedIdeal.insert(RenameVariables(ChangeOrder<DegreeRevLexOrder>(p), newIndices));
+        }
+        extendedIdeal.insert(one - t * RenameVariables(ChangeOrder<DegreeRevLexOrder>(f), newIndices));
+        return RenameVariables(EliminateFirstVariables<1>(extendedIdeal), GetInverseIndices(newIndices));
+    }
+}
+
+#endif //GROEBNER_ELIMINATION_H
@@ -1,5 +1,9 @@
-#include "test.h"
-
-int main() {
-    Groebner::test_all();
-}
\ No newline at end of file
+#include "batch.h"
+#include "test.h"
+
+int main(int argc, char** argv) {
+    if (argc > 1 && std::string(argv[1]) == "--batch") {
+        return Groebner::RunBatchDriver(argc, argv, std::cin, std::cout);
+    }
+    Groebner::test_all();
+}
@@ -0,0 +1,76 @@
+#include "modular.h"
+
+namespace Groebner {
+    ModulusScope::ModulusScope(uint32_t prime) : previous(Modular::modulus) {
+        if (!IsPrime(prime) || prime >= (1u << 31)) {
+            throw std::runtime_error("Modulus should be a prime below 2^31.");
+        }
+        Modular::modulus = prime;
+    }
+
+    ModulusScope::~ModulusScope() {
+        Modular::modulus = previous;
+    }
+
+    namespace {
+        uint64_t PowerModulo(uint64_t base, uint64_t exponent, uint64_t modulus) {
+            uint64_t result = 1;
+            base %= modulus;
+            for (; exponent > 0; exponent /= 2) {
+                if (exponent % 2 == 1) {
+                    result = result * base % modulus;
+                }
+                base = base * base % modulus;
+            }
+            return result;
+        }
+    }
+
+    // Miller-Rabin with the bases 2, 7 and 61, which is deterministic below 2^32.
+    bool IsPrime(uint32_t n) {
+        if (n < 2) {
+            return false;
+        }
+        for (uint32_t divisor : {2u, 3u, 5u, 7u, 61u}) {
+            if (n % divisor == 0) {
+                return n == divisor;
+            }
+        }
+        uint32_t odd = n - 1;
+        size_t twos = 0;
+        while (odd % 2 == 0) {
+            odd /= 2;
+            ++twos;
+        }
+        for (uint64_t base : {2u, 7u, 61u}) {
+            uint64_t x = PowerModulo(base, odd, n);
+            if (x == 1 || x == n - 1) {
+                continue;
+            }
+            bool isWitness = true;
+            for (size_t step = 1; step < twos && isWitness; ++step) {
+                x = x * x % n;
+                isWitness = (x != n - 1);
+            }
+            if (isWitness) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint32_t GetRandomPrime(std::mt19937_64* generator) {
+        std::uniform_int_distribution<uint32_t> distribution(1u << 30, (1u << 31) - 1);
+        for (;;) {
+            uint32_t candidate = distribution(*generator) | 1u;
+            if (IsPrime(candidate)) {
+                return candidate;
+            }
+        }
+    }
+
+    uint32_t GetRandomPrime() {
+        thread_local std::mt19937_64 generator(std::random_device{}());
+        return GetRandomPrime(&generator);
+    }
+}
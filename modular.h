@@ -0,0 +1,128 @@
+#ifndef GROEBNER_MODULAR_H
+#define GROEBNER_MODULAR_H
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <boost/functional/hash.hpp>
+
+namespace Groebner {
+    // Residue modulo a prime below 2^31. The modulus is per thread and is set by ModulusScope,
+    // so polynomials over different primes may be computed concurrently on different threads.
+    class Modular {
+     public:
+        Modular(long long value = 0)
+            : value(static_cast<uint32_t>((value % static_cast<long long>(modulus) + modulus) % modulus)) {}
+
+        uint32_t getValue() const {
+            return value;
+        }
+
+        static uint32_t getModulus() {
+            return modulus;
+        }
+
+        Modular& operator+=(const Modular& other) {
+            value += other.value;
+            if (value >= modulus) {
+                value -= modulus;
+            }
+            return *this;
+        }
+
+        Modular& operator-=(const Modular& other) {
+            value = (value >= other.value ? value - other.value : value + modulus - other.value);
+            return *this;
+        }
+
+        Modular& operator*=(const Modular& other) {
+            value = static_cast<uint32_t>(static_cast<uint64_t>(value) * other.value % modulus);
+            return *this;
+        }
+
+        Modular& operator/=(const Modular& other) {
+            return *this *= other.inverse();
+        }
+
+        // Fermat inverse, the modulus being prime.
+        Modular inverse() const {
+            if (value == 0) {
+                throw std::runtime_error("Division by zero residue.");
+            }
+            Modular result(1);
+            Modular base(*this);
+            for (uint32_t exponent = modulus - 2; exponent > 0; exponent /= 2) {
+                if (exponent % 2 == 1) {
+                    result *= base;
+                }
+                base *= base;
+            }
+            return result;
+        }
+
+        Modular operator-() const {
+            Modular result;
+            result.value = (value == 0 ? 0 : modulus - value);
+            return result;
+        }
+
+        friend Modular operator+(Modular lhs, const Modular& rhs) {
+            return lhs += rhs;
+        }
+
+        friend Modular operator-(Modular lhs, const Modular& rhs) {
+            return lhs -= rhs;
+        }
+
+        friend Modular operator*(Modular lhs, const Modular& rhs) {
+            return lhs *= rhs;
+        }
+
+        friend Modular operator/(Modular lhs, const Modular& rhs) {
+            return lhs /= rhs;
+        }
+
+        friend bool operator==(const Modular& lhs, const Modular& rhs) {
+            return lhs.value == rhs.value;
+        }
+
+        friend bool operator!=(const Modular& lhs, const Modular& rhs) {
+            return lhs.value != rhs.value;
+        }
+
+        friend std::ostream& operator<<(std::ostream& os, const Modular& m) {
+            return os << m.value;
+        }
+
+        friend std::size_t hash_value(const Modular& m) {
+            return boost::hash_value(m.value);
+        }
+     private:
+        friend class ModulusScope;
+
+        uint32_t value;
+        static inline thread_local uint32_t modulus = 2147483647;
+    };
+
+    // Sets the modulus of the current thread for its lifetime, restoring the previous one after.
+    // Residues created under one modulus should not be used under another.
+    class ModulusScope {
+     public:
+        explicit ModulusScope(uint32_t prime);
+        ModulusScope(const ModulusScope&) = delete;
+        ModulusScope& operator=(const ModulusScope&) = delete;
+        ~ModulusScope();
+     private:
+        uint32_t previous;
+    };
+
+    bool IsPrime(uint32_t n);
+
+    // Uniformly random prime in [2^30, 2^31), there are about 5 * 10^7 of them.
+    uint32_t GetRandomPrime(std::mt19937_64* generator);
+    // Same with a per-thread generator seeded from std::random_device.
+    uint32_t GetRandomPrime();
+}
+
+#endif //GROEBNER_MODULAR_H
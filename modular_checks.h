@@ -0,0 +1,108 @@
+#ifndef GROEBNER_MODULAR_CHECKS_H
+#define GROEBNER_MODULAR_CHECKS_H
+
+#include "algorithm.h"
+#include "modular.h"
+#include "boost/rational.hpp"
+
+namespace Groebner {
+    // Number of random primes that should all give a negative answer before it is returned without the exact check.
+    constexpr size_t ModularChecksCount = 2;
+
+    // Residue under the current modulus, false if the modulus divides the denominator.
+    template <typename IntType>
+    bool ToModular(const boost::rational<IntType>& r, Modular* result) {
+        Modular denominator(static_cast<long long>(r.denominator() % static_cast<IntType>(Modular::getModulus())));
+        if (denominator == Modular(0)) {
+            return false;
+        }
+        *result = Modular(static_cast<long long>(r.numerator() % static_cast<IntType>(Modular::getModulus()))) / denominator;
+        return true;
+    }
+
+    template <typename IntType, typename OrderType>
+    bool ToModular(const Polynomial<boost::rational<IntType>, OrderType>& p, Polynomial<Modular, OrderType>* result) {
+        using Poly = Polynomial<boost::rational<IntType>, OrderType>;
+        std::vector<typename Polynomial<Modular, OrderType>::Term> terms;
+        for (const auto& term : p) {
+            Modular coefficient;
+            if (!ToModular(Poly::getCoefficient(term), &coefficient)) {
+                return false;
+            }
+            terms.emplace_back(Poly::getMonomial(term), coefficient);
+        }
+        *result = Polynomial<Modular, OrderType>(terms.begin(), terms.end());
+        return true;
+    }
+
+    template <typename IntType, typename OrderType>
+    bool ToModular(const PolynomialSet<boost::rational<IntType>, OrderType>& set, PolynomialSet<Modular, OrderType>* result) {
+        result->clear();
+        for (const auto& p : set) {
+            Polynomial<Modular, OrderType> residue;
+            if (!ToModular(p, &residue)) {
+                return false;
+            }
+            result->insert(std::move(residue));
+        }
+        return true;
+    }
+
+    // Runs the check under ModularChecksCount random primes not dividing any denominator of the input,
+    // the check gets the ideal and the polynomial reduced modulo the prime and returns true on a negative answer.
+    template <typename IntType, typename OrderType, typename Check>
+    bool IsNegativeModuloRandomPrimes(const PolynomialSet<boost::rational<IntType>, OrderType>& ideal,
+                                      const Polynomial<boost::rational<IntType>, OrderType>& p, Check check) {
+        for (size_t checkIndex = 0; checkIndex < ModularChecksCount;) {
+            ModulusScope scope(GetRandomPrime());
+            PolynomialSet<Modular, OrderType> modularIdeal;
+            Polynomial<Modular, OrderType> modularP;
+            if (!ToModular(ideal, &modularIdeal) || !ToModular(p, &modularP)) {
+                continue;
+            }
+            if (!check(std::move(modularIdeal), std::move(modularP))) {
+                return false;
+            }
+            ++checkIndex;
+        }
+        return true;
+    }
+
+    // Modular answers are exact unless the prime divides a denominator of the cofactors expressing p
+    // (or 1 for the radical and the unit ideal) through the generators, then a true answer may look negative.
+    // A certificate of height H has at most log2(H) / 30 such primes among the 5 * 10^7 primes used, so with k
+    // of them a false negative comes with probability at most (k / (5 * 10^7))^ModularChecksCount.
+    // Positive answers are never returned by the modular path, the exact computation confirms them.
+    template <typename IntType, typename OrderType>
+    bool FastLaysInIdeal(const PolynomialSet<boost::rational<IntType>, OrderType>& ideal,
+                         const Polynomial<boost::rational<IntType>, OrderType>& p) {
+        bool isNegative = IsNegativeModuloRandomPrimes(ideal, p, [](PolynomialSet<Modular, OrderType> modularIdeal,
+                                                                    Polynomial<Modular, OrderType> modularP) {
+            return !LaysInIdeal(std::move(modularIdeal), std::move(modularP));
+        });
+        return !isNegative && LaysInIdeal(ideal, p);
+    }
+
+    template <typename IntType, typename OrderType>
+    bool FastLaysInRadical(const PolynomialSet<boost::rational<IntType>, OrderType>& ideal,
+                           const Polynomial<boost::rational<IntType>, OrderType>& p) {
+        bool isNegative = IsNegativeModuloRandomPrimes(ideal, p, [](PolynomialSet<Modular, OrderType> modularIdeal,
+                                                                    Polynomial<Modular, OrderType> modularP) {
+            return !LaysInRadical(std::move(modularIdeal), std::move(modularP));
+        });
+        return !isNegative && LaysInRadical(ideal, p);
+    }
+
+    template <typename IntType, typename OrderType>
+    bool FastIsUnitIdeal(const PolynomialSet<boost::rational<IntType>, OrderType>& ideal) {
+        using Poly = Polynomial<boost::rational<IntType>, OrderType>;
+        Poly one(boost::rational<IntType>(1));
+        bool isNegative = IsNegativeModuloRandomPrimes(ideal, one, [](PolynomialSet<Modular, OrderType> modularIdeal,
+                                                                      Polynomial<Modular, OrderType> modularOne) {
+            return !LaysInIdeal(std::move(modularIdeal), std::move(modularOne));
+        });
+        return !isNegative && LaysInIdeal(ideal, one);
+    }
+}
+
+#endif //GROEBNER_MODULAR_CHECKS_H
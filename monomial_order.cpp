@@ -1,6 +1,25 @@
 #include "monomial_order.h"
 
 namespace Groebner {
+    namespace {
+        size_t GetFirstNonEqualVariable(const Monomial& lhs, const Monomial& rhs, size_t firstVariable, size_t lastVariable) {
+            lastVariable = std::min(lastVariable, std::max(lhs.greatestVariableIndex(), rhs.greatestVariableIndex()));
+            size_t nonEqualVariableIndex = firstVariable;
+            while (nonEqualVariableIndex < lastVariable && lhs.degree(nonEqualVariableIndex) == rhs.degree(nonEqualVariableIndex)) {
+                ++nonEqualVariableIndex;
+            }
+            return nonEqualVariableIndex;
+        }
+
+        Monomial::DegreeType GetDegreeOnRange(const Monomial& m, size_t firstVariable, size_t lastVariable) {
+            Monomial::DegreeType degree = 0;
+            for (size_t variableIndex = firstVariable; variableIndex < std::min(lastVariable, m.greatestVariableIndex()); ++variableIndex) {
+                degree += m.degree(variableIndex);
+            }
+            return degree;
+        }
+    }
+
     bool LexOrder::isLess(const Monomial& lhs, const Monomial& rhs) {
         if (lhs == rhs) {
             return false;
@@ -12,6 +31,11 @@ namespace Groebner {
         return lhs.degree(nonEqualVariableIndex) < rhs.degree(nonEqualVariableIndex);
     }
 
+    bool LexOrder::isLess(const Monomial& lhs, const Monomial& rhs, size_t firstVariable, size_t lastVariable) {
+        size_t nonEqualVariableIndex = GetFirstNonEqualVariable(lhs, rhs, firstVariable, lastVariable);
+        return nonEqualVariableIndex < lastVariable && lhs.degree(nonEqualVariableIndex) < rhs.degree(nonEqualVariableIndex);
+    }
+
     bool RevLexOrder::isLess(const Monomial& lhs, const Monomial& rhs) {
         if (lhs == rhs) {
             return false;
@@ -23,7 +47,34 @@ namespace Groebner {
         return lhs.degree(nonEqualVariableIndex) > rhs.degree(nonEqualVariableIndex);
     }
 
+    bool RevLexOrder::isLess(const Monomial& lhs, const Monomial& rhs, size_t firstVariable, size_t lastVariable) {
+        size_t nonEqualVariableIndex = GetFirstNonEqualVariable(lhs, rhs, firstVariable, lastVariable);
+        return nonEqualVariableIndex < lastVariable && lhs.degree(nonEqualVariableIndex) > rhs.degree(nonEqualVariableIndex);
+    }
+
     bool DegreeOrder::isLess(const Monomial& lhs, const Monomial& rhs) {
         return lhs.totalDegree() < rhs.totalDegree();
     }
-}
\ No newline at end of file
+
+    bool DegreeOrder::isLess(const Monomial& lhs, const Monomial& rhs, size_t firstVariable, size_t lastVariable) {
+        return GetDegreeOnRange(lhs, firstVariable, lastVariable) < GetDegreeOnRange(rhs, firstVariable, lastVariable);
+    }
+
+    bool RuntimeBlockOrder::isLess(const Monomial& lhs, const Monomial& rhs) {
+        if (DegreeRevLexOrder::isLess(lhs, rhs, 0, blockSize)) {
+            return true;
+        }
+        if (DegreeRevLexOrder::isLess(rhs, lhs, 0, blockSize)) {
+            return false;
+        }
+        return DegreeRevLexOrder::isLess(lhs, rhs, blockSize, std::numeric_limits<size_t>::max());
+    }
+
+    BlockSizeScope::BlockSizeScope(size_t blockSize) : previous(RuntimeBlockOrder::blockSize) {
+        RuntimeBlockOrder::blockSize = blockSize;
+    }
+
+    BlockSizeScope::~BlockSizeScope() {
+        RuntimeBlockOrder::blockSize = previous;
+    }
+}
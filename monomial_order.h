@@ -1,23 +1,30 @@
 #ifndef GROEBNER_MONOMIAL_ORDER_H
 #define GROEBNER_MONOMIAL_ORDER_H
 
+#include <algorithm>
 #include <functional>
+#include <limits>
 #include "monomial.h"
 
 namespace Groebner {
+    // The overloads taking a range of variables compare the monomials as if the degrees
+    // of the variables outside firstVariable..lastVariable-1 were zero, without building them.
     class LexOrder {
      public:
         static bool isLess(const Monomial& lhs, const Monomial& rhs);
+        static bool isLess(const Monomial& lhs, const Monomial& rhs, size_t firstVariable, size_t lastVariable);
     };
 
     class RevLexOrder {
      public:
         static bool isLess(const Monomial& lhs, const Monomial& rhs);
+        static bool isLess(const Monomial& lhs, const Monomial& rhs, size_t firstVariable, size_t lastVariable);
     };
 
     class DegreeOrder {
      public:
         static bool isLess(const Monomial& lhs, const Monomial& rhs);
+        static bool isLess(const Monomial& lhs, const Monomial& rhs, size_t firstVariable, size_t lastVariable);
     };
 
     template <class TOrder1, class TOrder2>
@@ -30,11 +37,60 @@ namespace Groebner {
                 return false;
             return TOrder2::isLess(first, second);
         }
+
+        static bool isLess(const Monomial& first, const Monomial& second, size_t firstVariable, size_t lastVariable) {
+            if (TOrder1::isLess(first, second, firstVariable, lastVariable))
+                return true;
+            if (TOrder1::isLess(second, first, firstVariable, lastVariable))
+                return false;
+            return TOrder2::isLess(first, second, firstVariable, lastVariable);
+        }
+    };
+
+    // Compares monomials by TOrder, looking only at variables FirstVariable..LastVariable-1.
+    template <size_t FirstVariable, size_t LastVariable, class TOrder>
+    class Restriction {
+     public:
+        static bool isLess(const Monomial& first, const Monomial& second) {
+            return TOrder::isLess(first, second, FirstVariable, LastVariable);
+        }
+
+        static bool isLess(const Monomial& first, const Monomial& second, size_t firstVariable, size_t lastVariable) {
+            return TOrder::isLess(first, second, std::max(FirstVariable, firstVariable), std::min(LastVariable, lastVariable));
+        }
     };
 
     using DegreeLexOrder = Sum<DegreeOrder, LexOrder>;
     using DegreeRevLexOrder = Sum<DegreeOrder, RevLexOrder>;
 
+    // Elimination order: the first BlockSize variables are compared by TOrder1, the rest by TOrder2.
+    template <size_t BlockSize, class TOrder1 = DegreeRevLexOrder, class TOrder2 = DegreeRevLexOrder>
+    using BlockOrder = Sum<Restriction<0, BlockSize, TOrder1>,
+                           Restriction<BlockSize, std::numeric_limits<size_t>::max(), TOrder2>>;
+
+    // Elimination order with DegRevLex in both blocks, the size of the first block being set per thread
+    // by BlockSizeScope. The order of a polynomial changes with the block size, so polynomials ordered by it
+    // are valid only on the thread and inside the scope they were built in. Used by EliminateVariables alone.
+    class RuntimeBlockOrder {
+     public:
+        static bool isLess(const Monomial& lhs, const Monomial& rhs);
+     private:
+        friend class BlockSizeScope;
+
+        static inline thread_local size_t blockSize = 0;
+    };
+
+    // Sets the first block size of RuntimeBlockOrder on the current thread, restoring the previous one after.
+    class BlockSizeScope {
+     public:
+        explicit BlockSizeScope(size_t blockSize);
+        BlockSizeScope(const BlockSizeScope&) = delete;
+        BlockSizeScope& operator=(const BlockSizeScope&) = delete;
+        ~BlockSizeScope();
+     private:
+        size_t previous;
+    };
+
 }
 
 #endif //GROEBNER_MONOMIAL_ORDER_H
@@ -0,0 +1,73 @@
+#ifndef GROEBNER_MULTIPLICATION_H
+#define GROEBNER_MULTIPLICATION_H
+
+#include "polynomial.h"
+#include "thread_pool.h"
+#include <memory>
+
+namespace Groebner {
+    // Number of term pairs from which a product is worth splitting between threads.
+    constexpr size_t ParallelMultiplyThreshold = 4096;
+
+    // The larger operand is cut into contiguous chunks, every chunk is multiplied by the other operand
+    // into its own partial product, and the partial products are summed pairwise in a tree.
+    // Every task writes only to its own slots, so no locks are taken besides the pool ones.
+    // Should not be called from a task of the same pool, as it waits for the pool to become idle.
+    template <typename FieldElement, typename OrderType>
+    Polynomial<FieldElement, OrderType> ParallelMultiply(const Polynomial<FieldElement, OrderType>& lhs,
+                                                         const Polynomial<FieldElement, OrderType>& rhs,
+                                                         ThreadPool* pool) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        const Poly& chunked = (lhs.size() >= rhs.size() ? lhs : rhs);
+        const Poly& other = (lhs.size() >= rhs.size() ? rhs : lhs);
+        size_t chunksCount = std::min(chunked.size(), 4 * pool->size());
+        if (pool->size() == 1 || chunksCount <= 1) {
+            return lhs * rhs;
+        }
+
+        std::vector<decltype(chunked.begin())> bounds;
+        auto position = chunked.begin();
+        for (size_t chunkIndex = 0; chunkIndex < chunksCount; ++chunkIndex) {
+            bounds.push_back(position);
+            std::advance(position, chunked.size() / chunksCount + (chunkIndex < chunked.size() % chunksCount ? 1 : 0));
+        }
+        bounds.push_back(chunked.end());
+
+        std::vector<Poly> partials(chunksCount);
+        for (size_t chunkIndex = 0; chunkIndex < chunksCount; ++chunkIndex) {
+            pool->submit([&, chunkIndex] {
+                for (auto term = bounds[chunkIndex]; term != bounds[chunkIndex + 1]; ++term) {
+                    partials[chunkIndex].addMultiple(Poly::getMonomial(*term), Poly::getCoefficient(*term), other);
+                }
+            });
+        }
+        pool->wait();
+
+        for (size_t step = 1; step < chunksCount; step *= 2) {
+            for (size_t chunkIndex = 0; chunkIndex + step < chunksCount; chunkIndex += 2 * step) {
+                pool->submit([&, chunkIndex, step] {
+                    partials[chunkIndex] += partials[chunkIndex + step];
+                    partials[chunkIndex + step] = Poly();
+                });
+            }
+            pool->wait();
+        }
+        return std::move(partials.front());
+    }
+
+    // Multiplies in parallel when the product is large enough, creating the pool on first use.
+    template <typename FieldElement, typename OrderType>
+    Polynomial<FieldElement, OrderType> Multiply(const Polynomial<FieldElement, OrderType>& lhs,
+                                                 const Polynomial<FieldElement, OrderType>& rhs,
+                                                 std::unique_ptr<ThreadPool>* pool) {
+        if (lhs.size() * rhs.size() < ParallelMultiplyThreshold || std::thread::hardware_concurrency() <= 1) {
+            return lhs * rhs;
+        }
+        if (!*pool) {
+            *pool = std::make_unique<ThreadPool>();
+        }
+        return ParallelMultiply(lhs, rhs, pool->get());
+    }
+}
+
+#endif //GROEBNER_MULTIPLICATION_H
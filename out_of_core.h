@@ -0,0 +1,268 @@
+#ifndef GROEBNER_OUT_OF_CORE_H
+#define GROEBNER_OUT_OF_CORE_H
+
+#include "algorithm.h"
+#include "spill.h"
+#include <list>
+#include <memory>
+#include <optional>
+
+namespace Groebner {
+    // Basis whose polynomials may live in a spill file. Leading terms and the index by leading monomial stay
+    // in memory, so reducers are found without touching the polynomials, and an element is paged back in
+    // only when it is used. Resident elements above residentLimit bytes are evicted least recently used first;
+    // every element is packed at most once, as elements are immutable between replace calls.
+    template <typename FieldElement, typename OrderType>
+    class SpilledBasis {
+        using Poly = Polynomial<FieldElement, OrderType>;
+     public:
+        using Id = size_t;
+        static constexpr Id NoId = std::numeric_limits<Id>::max();
+
+        SpilledBasis(SpillFile* file, size_t residentLimit) : file(file), residentLimit(residentLimit) {}
+
+        Id insert(Poly p) {
+            Id id = entries.size();
+            entries.emplace_back();
+            replace(id, std::move(p));
+            return id;
+        }
+
+        // A zero polynomial leaves the id empty.
+        void replace(Id id, Poly p) {
+            erase(id);
+            if (p == FieldElement(0)) {
+                return;
+            }
+            auto& entry = entries[id];
+            entry.leadingMonomial = Poly::getMonomial(p.leadingTerm());
+            entry.leadingCoefficient = Poly::getCoefficient(p.leadingTerm());
+            entry.record.reset();
+            entry.alive = true;
+            index.emplace(entry.leadingMonomial, id);
+            makeResident(id, std::make_shared<const Poly>(std::move(p)));
+        }
+
+        void erase(Id id) {
+            auto& entry = entries[id];
+            if (!entry.alive) {
+                return;
+            }
+            auto range = index.equal_range(entry.leadingMonomial);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second == id) {
+                    index.erase(it);
+                    break;
+                }
+            }
+            dropResident(id);
+            entry.alive = false;
+        }
+
+        bool contains(Id id) const {
+            return id < entries.size() && entries[id].alive;
+        }
+
+        // Pages the element in if needed. The pointer stays valid after the element is evicted.
+        std::shared_ptr<const Poly> get(Id id) {
+            auto& entry = entries[id];
+            if (entry.resident) {
+                lru.splice(lru.begin(), lru, entry.lruPosition);
+                return entry.resident;
+            }
+            ++pagedInCount;
+            auto p = std::make_shared<const Poly>(UnpackPolynomial<FieldElement, OrderType>(file->getData(*entry.record)));
+            makeResident(id, p);
+            return p;
+        }
+
+        const Monomial& getLeadingMonomial(Id id) const {
+            return entries[id].leadingMonomial;
+        }
+
+        const FieldElement& getLeadingCoefficient(Id id) const {
+            return entries[id].leadingCoefficient;
+        }
+
+        // Returns an element other than the skipped one with the leading monomial dividing m, or NoId.
+        Id findReducer(const Monomial& m, Id skipped = NoId) const {
+            for (auto it = index.begin(); it != index.end() && !OrderType::isLess(m, it->first); ++it) {
+                if (it->second != skipped && m.isDivisibleBy(it->first)) {
+                    return it->second;
+                }
+            }
+            return NoId;
+        }
+
+        // Live ids in increasing order.
+        std::vector<Id> getIds() const {
+            std::vector<Id> ids;
+            for (Id id = 0; id < entries.size(); ++id) {
+                if (contains(id)) {
+                    ids.push_back(id);
+                }
+            }
+            return ids;
+        }
+
+        size_t size() const {
+            return index.size();
+        }
+
+        size_t getResidentBytes() const {
+            return residentBytes;
+        }
+
+        size_t getPagedInCount() const {
+            return pagedInCount;
+        }
+     private:
+        struct Entry {
+            Monomial leadingMonomial;
+            FieldElement leadingCoefficient;
+            std::shared_ptr<const Poly> resident;
+            std::optional<SpillRecord> record;
+            std::list<Id>::iterator lruPosition;
+            size_t bytes = 0;
+            bool alive = false;
+        };
+
+        SpillFile* file;
+        size_t residentLimit;
+        std::vector<Entry> entries;
+        std::multimap<Monomial, Id, OrderAdaptor<OrderType>> index;
+        // Resident ids, the most recently used first.
+        std::list<Id> lru;
+        size_t residentBytes = 0;
+        size_t pagedInCount = 0;
+
+        void makeResident(Id id, std::shared_ptr<const Poly> p) {
+            auto& entry = entries[id];
+            entry.bytes = EstimateMemoryUsage(*p);
+            entry.resident = std::move(p);
+            lru.push_front(id);
+            entry.lruPosition = lru.begin();
+            residentBytes += entry.bytes;
+            // The element just made resident is kept even if it alone exceeds the limit.
+            while (residentBytes > residentLimit && lru.size() > 1) {
+                evict(lru.back());
+            }
+        }
+
+        void evict(Id id) {
+            auto& entry = entries[id];
+            if (!entry.record) {
+                std::vector<char> bytes;
+                PackPolynomial(*entry.resident, &bytes);
+                entry.record = file->append(bytes);
+            }
+            dropResident(id);
+        }
+
+        void dropResident(Id id) {
+            auto& entry = entries[id];
+            if (!entry.resident) {
+                return;
+            }
+            lru.erase(entry.lruPosition);
+            residentBytes -= entry.bytes;
+            entry.resident.reset();
+        }
+    };
+
+    // Reduces the terms of g from the highest one down, paging in only the reducers used. If g is the tail
+    // of the element with the given id, its leading term is kept and the element is not used as a reducer.
+    template <typename FieldElement, typename OrderType>
+    void ReduceOverSpilledBasis(SpilledBasis<FieldElement, OrderType>* basis, Polynomial<FieldElement, OrderType>* g,
+                                typename SpilledBasis<FieldElement, OrderType>::Id skipped = SpilledBasis<FieldElement, OrderType>::NoId) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        const Poly& reduced = *g;
+        auto term = reduced.rbegin();
+        if (skipped != SpilledBasis<FieldElement, OrderType>::NoId && term != reduced.rend()) {
+            ++term;
+        }
+        while (term != reduced.rend()) {
+            const Monomial monomial = Poly::getMonomial(*term);
+            auto reducerId = basis->findReducer(monomial, skipped);
+            if (reducerId == SpilledBasis<FieldElement, OrderType>::NoId) {
+                ++term;
+                continue;
+            }
+            FieldElement coefficient = Poly::getCoefficient(*term) / basis->getLeadingCoefficient(reducerId);
+            g->subtractMultiple(monomial / basis->getLeadingMonomial(reducerId), coefficient, *basis->get(reducerId));
+            // Only the terms below the reduced one have changed.
+            term = std::make_reverse_iterator(reduced.lowerBound(monomial));
+        }
+    }
+
+    // Ids of a pending pair, stored bytewise in the spilled queue.
+    struct QueuedPair {
+        size_t first;
+        size_t second;
+    };
+
+    // Buchberger algorithm for bases that do not fit in memory. Basis elements above options.spillThreshold
+    // resident bytes and queued pairs above the same bound go to a memory-mapped spill file. Reduced
+    // S-polynomials join the basis at once, so no batch of them is held in memory, and pairs are taken in
+    // the order of creation, skipping those with coprime leading monomials. On abort the set holds the
+    // elements computed so far, which generate the same ideal.
+    template <typename FieldElement, typename OrderType>
+    BuhbergerStatus DoOutOfCoreBuhberger(PolynomialSet<FieldElement, OrderType>* set,
+                                         const BuhbergerOptions& options = BuhbergerOptions()) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        using Id = typename SpilledBasis<FieldElement, OrderType>::Id;
+        BuhbergerController controller(options);
+        SpillFile file(options.spillDirectory);
+        SpilledBasis<FieldElement, OrderType> basis(&file, options.spillThreshold);
+        SpilledQueue<QueuedPair> pairs(&file, options.spillThreshold);
+        auto insert = [&](Poly p) {
+            p.normalize();
+            Id newId = basis.insert(std::move(p));
+            for (auto id : basis.getIds()) {
+                if (id != newId) {
+                    pairs.push({id, newId});
+                }
+            }
+        };
+        for (const auto& p : *set) {
+            if (p != FieldElement(0)) {
+                insert(p);
+            }
+        }
+
+        while (!pairs.empty() && !controller.shouldStop()) {
+            auto pair = pairs.pop();
+            const auto& firstMonomial = basis.getLeadingMonomial(pair.first);
+            const auto& secondMonomial = basis.getLeadingMonomial(pair.second);
+            Monomial lcm12 = lcm(firstMonomial, secondMonomial);
+            controller.reportProgress({basis.size(), pairs.size(), lcm12.totalDegree()});
+            if (lcm12 == firstMonomial * secondMonomial) {
+                continue;
+            }
+            auto S = S_Polynomial(*basis.get(pair.first), *basis.get(pair.second));
+            ReduceOverSpilledBasis(&basis, &S);
+            if (S != FieldElement(0)) {
+                insert(std::move(S));
+            }
+        }
+        if (controller.getStatus() == BuhbergerStatus::Completed) {
+            for (auto id : basis.getIds()) {
+                if (basis.findReducer(basis.getLeadingMonomial(id), id) != SpilledBasis<FieldElement, OrderType>::NoId) {
+                    basis.erase(id);
+                }
+            }
+            for (auto id : basis.getIds()) {
+                Poly p = *basis.get(id);
+                ReduceOverSpilledBasis(&basis, &p, id);
+                basis.replace(id, std::move(p));
+            }
+        }
+        set->clear();
+        for (auto id : basis.getIds()) {
+            set->insert(*basis.get(id));
+        }
+        return controller.getStatus();
+    }
+}
+
+#endif //GROEBNER_OUT_OF_CORE_H
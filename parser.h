@@ -0,0 +1,136 @@
+#ifndef GROEBNER_PARSER_H
+#define GROEBNER_PARSER_H
+
+#include "polynomial.h"
+#include <cctype>
+#include <limits>
+#include <string>
+
+namespace Groebner {
+    // Reads polynomials in the form printed by operator<<, like "-1/1(c^2) + (a^2)b",
+    // as well as the usual "a^2*b - 3/2*c + 1". Variables are the letters 'a' to 'z'.
+    template <typename FieldElement, typename OrderType>
+    class PolynomialParser {
+        using Poly = Polynomial<FieldElement, OrderType>;
+     public:
+        explicit PolynomialParser(const std::string& text) : text(text) {}
+
+        Poly parse() {
+            std::vector<typename Poly::Term> terms;
+            skipSpaces();
+            bool negative = readSign();
+            terms.push_back(readTerm(negative));
+            while (skipSpaces(), position < text.size()) {
+                if (text[position] != '+' && text[position] != '-') {
+                    fail();
+                }
+                negative = readSign();
+                terms.push_back(readTerm(negative));
+            }
+            return Poly(terms.begin(), terms.end());
+        }
+     private:
+        const std::string& text;
+        size_t position = 0;
+
+        [[noreturn]] void fail() const {
+            throw std::runtime_error("Can't parse polynomial \"" + text + "\" at position " + std::to_string(position) + ".");
+        }
+
+        void skipSpaces() {
+            while (position < text.size() && std::isspace(static_cast<unsigned char>(text[position]))) {
+                ++position;
+            }
+        }
+
+        bool tryRead(char c) {
+            skipSpaces();
+            if (position < text.size() && text[position] == c) {
+                ++position;
+                return true;
+            }
+            return false;
+        }
+
+        bool isDigitAhead() {
+            skipSpaces();
+            return position < text.size() && std::isdigit(static_cast<unsigned char>(text[position]));
+        }
+
+        bool isVariableAhead() {
+            skipSpaces();
+            return position < text.size() && text[position] >= 'a' && text[position] <= 'z';
+        }
+
+        bool readSign() {
+            bool negative = false;
+            while (true) {
+                if (tryRead('-')) {
+                    negative = !negative;
+                } else if (!tryRead('+')) {
+                    return negative;
+                }
+            }
+        }
+
+        // Numbers should fit a long long, the integer type of the rational coefficients.
+        long long readNumber() {
+            if (!isDigitAhead()) {
+                fail();
+            }
+            long long number = 0;
+            while (position < text.size() && std::isdigit(static_cast<unsigned char>(text[position]))) {
+                long long digit = text[position] - '0';
+                if (number > (std::numeric_limits<long long>::max() - digit) / 10) {
+                    fail();
+                }
+                number = number * 10 + digit;
+                ++position;
+            }
+            return number;
+        }
+
+        Monomial readFactor() {
+            bool parenthesized = tryRead('(');
+            if (!isVariableAhead()) {
+                fail();
+            }
+            size_t variableIndex = text[position++] - 'a';
+            size_t degree = 1;
+            if (tryRead('^')) {
+                degree = readNumber();
+            }
+            if (parenthesized && !tryRead(')')) {
+                fail();
+            }
+            return Monomial::getNthVariable(variableIndex, degree);
+        }
+
+        typename Poly::Term readTerm(bool negative) {
+            FieldElement coefficient(1);
+            bool hasCoefficient = isDigitAhead();
+            if (hasCoefficient) {
+                coefficient = FieldElement(readNumber());
+                if (tryRead('/')) {
+                    coefficient /= FieldElement(readNumber());
+                }
+                tryRead('*');
+            }
+            Monomial monomial;
+            if (!hasCoefficient || isVariableAhead() || (skipSpaces(), position < text.size() && text[position] == '(')) {
+                monomial = readFactor();
+                while (tryRead('*'), isVariableAhead() || (position < text.size() && text[position] == '(')) {
+                    monomial *= readFactor();
+                }
+            }
+            return {monomial, negative ? -coefficient : coefficient};
+        }
+    };
+
+    template <typename FieldElement, typename OrderType>
+    Polynomial<FieldElement, OrderType> ParsePolynomial(const std::string& text) {
+        return PolynomialParser<FieldElement, OrderType>(text).parse();
+    }
+}
+
+#endif //GROEBNER_PARSER_H
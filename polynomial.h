@@ -1,7 +1,7 @@
 #ifndef GROEBNER_POLYNOMIAL_H
 #define GROEBNER_POLYNOMIAL_H
 #include "monomial_order.h"
-#include "CTorCheck/CTorCheck.h"
+#include "copy_counter.h"
 #include <algorithm>
 #include <map>
 #include <vector>
@@ -18,7 +18,7 @@ namespace Groebner {
     };
 
     template <typename FieldElement, typename OrderType>
-    class Polynomial : public NSLibrary::CCTorCheck<Monomial, NSLibrary::CSilentMode> {
+    class Polynomial : public CopyCounter<Polynomial<FieldElement, OrderType>> {
         using TermMap = std::map<Monomial, FieldElement, OrderAdaptor<OrderType>>;
      public:
         using Term = typename TermMap::value_type;
@@ -37,6 +37,14 @@ namespace Groebner {
 
         Polynomial(Term t) : Polynomial{{std::move(t)}} {}
 
+        template <typename InputIterator>
+        Polynomial(InputIterator first, InputIterator last) {
+            for (; first != last; ++first) {
+                data[first->first] += first->second;
+            }
+            trimZeroes();
+        }
+
         typename TermMap::iterator begin() {
             return data.begin();
         };
@@ -69,6 +77,20 @@ namespace Groebner {
             return data.crend();
         };
 
+        size_t size() const {
+            return data.size();
+        }
+
+        // First term with monomial not less than m.
+        typename TermMap::const_iterator lowerBound(const Monomial& m) const {
+            return data.lower_bound(m);
+        }
+
+        FieldElement getCoefficientOf(const Monomial& m) const {
+            auto position = data.find(m);
+            return (position == data.end() ? FieldElement(0) : position->second);
+        }
+
         const Term& leadingTerm() const {
             assert(!data.empty());
             return *rbegin();
@@ -88,6 +110,11 @@ namespace Groebner {
             return ret;
         }
 
+        friend Polynomial operator+(Polynomial&& lhs, const Polynomial& rhs) {
+            lhs += rhs;
+            return std::move(lhs);
+        }
+
         Polynomial& operator-=(const Polynomial& other) {
             for (const Term& term : other.data) {
                 data[term.first] -= term.second;
@@ -102,8 +129,50 @@ namespace Groebner {
             return ret;
         }
 
+        friend Polynomial operator-(Polynomial&& lhs, const Polynomial& rhs) {
+            lhs -= rhs;
+            return std::move(lhs);
+        }
+
+        // Adds c * m * other term by term, without building the product.
+        Polynomial& addMultiple(const Monomial& m, const FieldElement& c, const Polynomial& other) {
+            for (const Term& term : other.data) {
+                auto position = data.emplace(term.first * m, FieldElement(0)).first;
+                position->second += c * term.second;
+                if (position->second == FieldElement(0)) {
+                    data.erase(position);
+                }
+            }
+            return *this;
+        }
+
+        Polynomial& subtractMultiple(const Monomial& m, const FieldElement& c, const Polynomial& other) {
+            return addMultiple(m, -c, other);
+        }
+
+        // Monomial orders are compatible with multiplication, so the terms keep their order
+        // and are moved to the new keys without reallocation.
+        Polynomial& multiplyByTerm(const Monomial& m, const FieldElement& c) {
+            if (c == FieldElement(0)) {
+                data.clear();
+                return *this;
+            }
+            TermMap multiplied;
+            while (!data.empty()) {
+                auto node = data.extract(data.begin());
+                node.key() *= m;
+                node.mapped() *= c;
+                multiplied.insert(multiplied.end(), std::move(node));
+            }
+            data.swap(multiplied);
+            return *this;
+        }
+
         // It's intentional!
         Polynomial& operator*=(const Polynomial& other) {
+            if (other.data.size() == 1) {
+                return multiplyByTerm(getMonomial(*other.data.begin()), getCoefficient(*other.data.begin()));
+            }
             *this = (*this) * other;
             return *this;
         }
@@ -119,9 +188,40 @@ namespace Groebner {
             return res;
         }
 
+        friend Polynomial operator*(Polynomial&& lhs, const Polynomial& rhs) {
+            lhs *= rhs;
+            return std::move(lhs);
+        }
+
+        Polynomial& scale(const FieldElement& f) {
+            if (f == FieldElement(0)) {
+                data.clear();
+                return *this;
+            }
+            for (Term& term : data) {
+                term.second *= f;
+            }
+            return *this;
+        }
+
+        Polynomial& negate() {
+            for (Term& term : data) {
+                term.second = -term.second;
+            }
+            return *this;
+        }
+
+        // Makes the leading coefficient equal to one.
+        Polynomial& normalize() {
+            if (!data.empty() && getCoefficient(leadingTerm()) != FieldElement(1)) {
+                *this /= FieldElement(getCoefficient(leadingTerm()));
+            }
+            return *this;
+        }
+
         Polynomial& operator/=(const FieldElement& f) {
-            for (const Term& term : data) {
-                data[term.first] /= f;
+            for (Term& term : data) {
+                term.second /= f;
             }
             return *this;
         }
@@ -132,6 +232,11 @@ namespace Groebner {
             return ret;
         }
 
+        friend Polynomial operator/(Polynomial&& lhs, const FieldElement& f) {
+            lhs /= f;
+            return std::move(lhs);
+        }
+
         static const Monomial& getMonomial(const Term& pair) {
             return pair.first;
         }
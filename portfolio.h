@@ -0,0 +1,160 @@
+#ifndef GROEBNER_PORTFOLIO_H
+#define GROEBNER_PORTFOLIO_H
+
+#include "algorithm.h"
+#include "preprocessing.h"
+#include "thread_pool.h"
+#include "walk.h"
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <type_traits>
+
+namespace Groebner {
+    // One way to compute the reduced basis in TargetOrder. The solver should poll the cancellation token
+    // and the memory budget of the options it gets, and return Completed only with the full result.
+    template <typename FieldElement, typename TargetOrder>
+    struct PortfolioStrategy {
+        std::string name;
+        std::function<BuhbergerStatus(const PolynomialSet<FieldElement, TargetOrder>&, const BuhbergerOptions&,
+                                      PolynomialSet<FieldElement, TargetOrder>*)> solve;
+    };
+
+    template <typename FieldElement, typename TargetOrder>
+    struct PortfolioResult {
+        static constexpr size_t NoWinner = std::numeric_limits<size_t>::max();
+
+        PolynomialSet<FieldElement, TargetOrder> basis;
+        // Index of the strategy that finished first, NoWinner if none has completed.
+        size_t winner = NoWinner;
+        // Status of every strategy, the losers are normally Cancelled.
+        std::vector<BuhbergerStatus> statuses;
+        // Messages of the strategies that threw, empty for the others.
+        std::vector<std::string> errors;
+    };
+
+    template <typename OrderType, typename = void>
+    struct HasWalkWeight : std::false_type {};
+
+    template <typename OrderType>
+    struct HasWalkWeight<OrderType, std::void_t<decltype(WalkWeight<OrderType>::get(0))>> : std::true_type {};
+
+    // Direct Buchberger with full and with top-only reductions, Buchberger after linear preprocessing,
+    // and, for orders other than DegRevLex that have a walk weight, DegRevLex followed by the Groebner walk.
+    // They differ in the order path and the reduction mode; the pair selection is the same, as DoBuhberger
+    // has no option for it. All of them compute over FieldElement: the modular arithmetic of the library
+    // only refutes membership, there is no rational reconstruction to lift a modular basis to the result.
+    template <typename FieldElement, typename TargetOrder>
+    std::vector<PortfolioStrategy<FieldElement, TargetOrder>> GetDefaultPortfolio() {
+        using Set = PolynomialSet<FieldElement, TargetOrder>;
+        std::vector<PortfolioStrategy<FieldElement, TargetOrder>> strategies;
+        strategies.push_back({"buchberger", [](const Set& ideal, const BuhbergerOptions& options, Set* basis) {
+            *basis = ideal;
+            return DoBuhberger(basis, options);
+        }});
+        strategies.push_back({"buchberger-top-only", [](const Set& ideal, const BuhbergerOptions& options, Set* basis) {
+            BuhbergerOptions topOnlyOptions = options;
+            topOnlyOptions.reductionMode = ReductionMode::TopOnly;
+            *basis = ideal;
+            return DoBuhberger(basis, topOnlyOptions);
+        }});
+        strategies.push_back({"preprocessing", [](const Set& ideal, const BuhbergerOptions& options, Set* basis) {
+            *basis = ideal;
+            return DoBuhbergerWithPreprocessing(basis, options);
+        }});
+        if constexpr (HasWalkWeight<TargetOrder>::value && !std::is_same_v<TargetOrder, DegreeRevLexOrder>) {
+            strategies.push_back({"degrevlex-walk", [](const Set& ideal, const BuhbergerOptions& options, Set* basis) {
+                BuhbergerStatus status;
+                *basis = DoGroebnerWalk<TargetOrder>(ChangeOrder<DegreeRevLexOrder>(ideal), options, &status);
+                return status;
+            }});
+        }
+        return strategies;
+    }
+
+    // Races the strategies on a pool with a thread per strategy and returns the result of the first one
+    // to complete. The others are cancelled through a token of the portfolio and are joined before returning.
+    // The default strategies poll it between pairs, interreduced elements, substitutions and lifted elements,
+    // so they stop within one such step; a strategy that does not poll delays the return until it finishes.
+    // They share the deadline and the memory budget of the options, and cancellation by the caller's token
+    // is passed on. Progress reports of all strategies go to the caller's callback one at a time, from the pool
+    // threads. If no strategy completes and some threw, the first exception is rethrown.
+    template <typename FieldElement, typename TargetOrder>
+    PortfolioResult<FieldElement, TargetOrder> RunPortfolio(const PolynomialSet<FieldElement, TargetOrder>& ideal,
+                                                            const std::vector<PortfolioStrategy<FieldElement, TargetOrder>>& strategies,
+                                                            const BuhbergerOptions& options = BuhbergerOptions()) {
+        PortfolioResult<FieldElement, TargetOrder> result;
+        result.statuses.assign(strategies.size(), BuhbergerStatus::Cancelled);
+        result.errors.resize(strategies.size());
+        if (strategies.empty()) {
+            return result;
+        }
+        CancellationToken losersToken;
+        BuhbergerOptions strategyOptions = options;
+        strategyOptions.cancellationToken = &losersToken;
+        std::mutex progressMutex;
+        if (options.progressCallback) {
+            strategyOptions.progressCallback = [&](const BuhbergerProgress& progress) {
+                std::lock_guard<std::mutex> lock(progressMutex);
+                options.progressCallback(progress);
+            };
+        }
+        std::mutex mutex;
+        std::condition_variable finished;
+        size_t finishedCount = 0;
+        std::exception_ptr firstError;
+
+        ThreadPool pool(strategies.size());
+        for (size_t index = 0; index < strategies.size(); ++index) {
+            pool.submit([&, index] {
+                PolynomialSet<FieldElement, TargetOrder> basis;
+                BuhbergerStatus status = BuhbergerStatus::Cancelled;
+                std::exception_ptr error;
+                try {
+                    status = strategies[index].solve(ideal, strategyOptions, &basis);
+                } catch (const std::exception& e) {
+                    error = std::current_exception();
+                    std::lock_guard<std::mutex> lock(mutex);
+                    result.errors[index] = e.what();
+                } catch (...) {
+                    // Nothing may escape into the pool worker, where it would terminate the program.
+                    error = std::current_exception();
+                    std::lock_guard<std::mutex> lock(mutex);
+                    result.errors[index] = "Unknown exception.";
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                result.statuses[index] = status;
+                if (error && !firstError) {
+                    firstError = error;
+                }
+                if (!error && status == BuhbergerStatus::Completed && result.winner == result.NoWinner) {
+                    result.winner = index;
+                    result.basis = std::move(basis);
+                    losersToken.cancel();
+                }
+                ++finishedCount;
+                finished.notify_all();
+            });
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (result.winner == result.NoWinner && finishedCount < strategies.size()) {
+                // The caller's token is polled, as strategies only see the token of the portfolio.
+                finished.wait_for(lock, std::chrono::milliseconds(10));
+                if (options.cancellationToken != nullptr && options.cancellationToken->isCancelled()) {
+                    losersToken.cancel();
+                }
+            }
+        }
+        losersToken.cancel();
+        pool.wait();
+        if (result.winner == result.NoWinner && firstError) {
+            std::rethrow_exception(firstError);
+        }
+        return result;
+    }
+}
+
+#endif //GROEBNER_PORTFOLIO_H
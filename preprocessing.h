@@ -0,0 +1,146 @@
+#ifndef GROEBNER_PREPROCESSING_H
+#define GROEBNER_PREPROCESSING_H
+
+#include "elimination.h"
+#include <type_traits>
+
+namespace Groebner {
+    // True for orders that compare monomials in the same way after the variables are renumbered densely
+    // keeping their relative order. Restrictions are not, as their bounds are fixed variable indices.
+    template <typename OrderType>
+    struct IsRenumberingInvariant : std::false_type {};
+
+    template <>
+    struct IsRenumberingInvariant<LexOrder> : std::true_type {};
+
+    template <>
+    struct IsRenumberingInvariant<RevLexOrder> : std::true_type {};
+
+    template <>
+    struct IsRenumberingInvariant<DegreeOrder> : std::true_type {};
+
+    template <typename TOrder1, typename TOrder2>
+    struct IsRenumberingInvariant<Sum<TOrder1, TOrder2>>
+        : std::integral_constant<bool, IsRenumberingInvariant<TOrder1>::value && IsRenumberingInvariant<TOrder2>::value> {};
+
+    template <typename FieldElement, typename OrderType>
+    Polynomial<FieldElement, OrderType> SubstituteVariable(const Polynomial<FieldElement, OrderType>& p, size_t variableIndex,
+                                                           const Polynomial<FieldElement, OrderType>& value) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        std::vector<Poly> powers{Poly(FieldElement(1))};
+        Poly result;
+        for (const auto& term : p) {
+            const auto& monomial = Poly::getMonomial(term);
+            size_t degree = monomial.degree(variableIndex);
+            while (powers.size() <= degree) {
+                powers.push_back(powers.back() * value);
+            }
+            result.addMultiple(monomial / Monomial::getNthVariable(variableIndex, degree), Poly::getCoefficient(term), powers[degree]);
+        }
+        return result;
+    }
+
+    // A generator with a single variable x_i as the leading monomial has no other terms with x_i,
+    // so it solves x_i for a polynomial in the other variables.
+    template <typename FieldElement, typename OrderType>
+    bool IsSolvedForVariable(const Polynomial<FieldElement, OrderType>& p, size_t* variableIndex) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        if (p == FieldElement(0)) {
+            return false;
+        }
+        const auto& leadingMonomial = Poly::getMonomial(p.leadingTerm());
+        if (leadingMonomial.totalDegree() != 1) {
+            return false;
+        }
+        *variableIndex = leadingMonomial.greatestVariableIndex() - 1;
+        return true;
+    }
+
+    // Eliminates the variables solved by generators x_i - f_i, substituting f_i into the rest of the system
+    // and into the previously solved ones; on the linear generators this is Gaussian elimination. The
+    // reduced system is computed without the eliminated variables, renumbered densely if the order allows,
+    // and x_i - NF(f_i) are added back. The leading monomials of the reduced system are free of x_i, so
+    // the union is the reduced basis whenever x_i stays the leading monomial of x_i - NF(f_i).
+    template <typename FieldElement, typename OrderType>
+    BuhbergerStatus DoBuhbergerWithPreprocessing(PolynomialSet<FieldElement, OrderType>* set,
+                                                 const BuhbergerOptions& options = BuhbergerOptions()) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        size_t variablesCount = GetVariablesCount(*set);
+        std::vector<Poly> pending(set->begin(), set->end());
+        std::vector<std::pair<size_t, Poly>> solved;
+        std::vector<bool> isEliminated(variablesCount, false);
+        BuhbergerController controller(options);
+        for (;;) {
+            if (controller.shouldStop()) {
+                // The substituted system with the solved generators still generates the same ideal.
+                set->clear();
+                set->insert(pending.begin(), pending.end());
+                for (const auto& [variableIndex, value] : solved) {
+                    set->insert(Poly(Monomial::getNthVariable(variableIndex)) - value);
+                }
+                return controller.getStatus();
+            }
+            size_t variableIndex = 0;
+            auto solvedGenerator = std::find_if(pending.begin(), pending.end(), [&](const Poly& p) {
+                return IsSolvedForVariable(p, &variableIndex);
+            });
+            if (solvedGenerator == pending.end()) {
+                break;
+            }
+            Poly value = std::move(*solvedGenerator);
+            pending.erase(solvedGenerator);
+            value.normalize();
+            value -= Poly(Monomial::getNthVariable(variableIndex));
+            value.negate();
+            for (auto& p : pending) {
+                p = SubstituteVariable(p, variableIndex, value);
+            }
+            for (auto& previous : solved) {
+                previous.second = SubstituteVariable(previous.second, variableIndex, value);
+            }
+            pending.erase(std::remove(pending.begin(), pending.end(), Poly()), pending.end());
+            solved.emplace_back(variableIndex, std::move(value));
+            isEliminated[variableIndex] = true;
+        }
+
+        PolynomialSet<FieldElement, OrderType> reduced(pending.begin(), pending.end());
+        BuhbergerStatus status;
+        if (IsRenumberingInvariant<OrderType>::value && !solved.empty()) {
+            std::vector<size_t> newIndices(variablesCount, variablesCount);
+            std::vector<size_t> oldIndices;
+            for (size_t variableIndex = 0; variableIndex < variablesCount; ++variableIndex) {
+                if (!isEliminated[variableIndex]) {
+                    newIndices[variableIndex] = oldIndices.size();
+                    oldIndices.push_back(variableIndex);
+                }
+            }
+            reduced = RenameVariables(reduced, newIndices);
+            status = DoBuhberger(&reduced, options);
+            reduced = RenameVariables(reduced, oldIndices);
+        } else {
+            status = DoBuhberger(&reduced, options);
+        }
+        if (reduced.count(Poly(FieldElement(1)))) {
+            *set = std::move(reduced);
+            return status;
+        }
+
+        bool isReduced = (status == BuhbergerStatus::Completed);
+        for (auto& [variableIndex, value] : solved) {
+            ReduceOverSetWhilePossible(reduced, &value, &controller);
+            Poly p = Poly(Monomial::getNthVariable(variableIndex)) - value;
+            isReduced = isReduced && Poly::getMonomial(p.leadingTerm()) == Monomial::getNthVariable(variableIndex);
+            reduced.insert(std::move(p));
+        }
+        *set = std::move(reduced);
+        if (controller.getStatus() != BuhbergerStatus::Completed) {
+            return controller.getStatus();
+        }
+        if (!isReduced && status == BuhbergerStatus::Completed) {
+            return DoBuhberger(set, options);
+        }
+        return status;
+    }
+}
+
+#endif //GROEBNER_PREPROCESSING_H
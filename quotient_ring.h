@@ -0,0 +1,324 @@
+#ifndef GROEBNER_QUOTIENT_RING_H
+#define GROEBNER_QUOTIENT_RING_H
+
+#include "algorithm.h"
+#include <deque>
+
+namespace Groebner {
+    // Arithmetic in k[x]/I for a zero-dimensional ideal given by its reduced basis. The staircase of normal
+    // monomials and sparse matrices of multiplication by the variables are computed once, after that elements
+    // are coordinate vectors over the staircase and no normal forms are computed.
+    template <typename FieldElement, typename OrderType>
+    class QuotientRing {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        using SparseColumn = std::vector<std::pair<size_t, FieldElement>>;
+     public:
+        using Element = std::vector<FieldElement>;
+
+        explicit QuotientRing(const PolynomialSet<FieldElement, OrderType>& basis)
+            : basis(basis)
+        {
+            for (const auto& p : basis) {
+                variablesCount = std::max(variablesCount, GetMaxVariableNumber(p));
+            }
+            checkZeroDimensional();
+            buildStaircase();
+            buildMultiplicationMatrices();
+        }
+
+        size_t getDimension() const {
+            return staircase.size();
+        }
+
+        // Normal monomials in increasing order, the coordinates of elements refer to them.
+        const std::vector<Monomial>& getStaircase() const {
+            return staircase;
+        }
+
+        Element one() const {
+            return toElement(Poly(FieldElement(1)));
+        }
+
+        Element toElement(Poly p) const {
+            ReduceOverSetWhilePossible(basis, &p);
+            Element result(staircase.size(), FieldElement(0));
+            for (const auto& term : p) {
+                result[staircaseIndices.at(Poly::getMonomial(term))] = Poly::getCoefficient(term);
+            }
+            return result;
+        }
+
+        Poly toPolynomial(const Element& element) const {
+            std::vector<typename Poly::Term> terms;
+            for (size_t index = 0; index < staircase.size(); ++index) {
+                if (element[index] != FieldElement(0)) {
+                    terms.emplace_back(staircase[index], element[index]);
+                }
+            }
+            return Poly(terms.begin(), terms.end());
+        }
+
+        Element add(Element lhs, const Element& rhs) const {
+            for (size_t index = 0; index < lhs.size(); ++index) {
+                lhs[index] += rhs[index];
+            }
+            return lhs;
+        }
+
+        Element multiplyByVariable(const Element& element, size_t variableIndex) const {
+            if (variableIndex >= variablesCount) {
+                throw std::runtime_error("Variable is not in the ring.");
+            }
+            Element result(staircase.size(), FieldElement(0));
+            for (size_t column = 0; column < staircase.size(); ++column) {
+                if (element[column] == FieldElement(0)) {
+                    continue;
+                }
+                for (const auto& entry : multiplicationMatrices[variableIndex][column]) {
+                    result[entry.first] += entry.second * element[column];
+                }
+            }
+            return result;
+        }
+
+        // Horner scheme over the tree of normal monomials: going from the greatest one down, every monomial
+        // passes the accumulated lhs times its part of rhs to its predecessor through a single sparse product.
+        // Monomials with no nonzero coordinate of rhs above them are skipped, so sparse factors are cheap.
+        Element multiply(const Element& lhs, const Element& rhs) const {
+            std::vector<Element> accumulated(staircase.size());
+            for (size_t index = staircase.size(); index-- > 0;) {
+                if (rhs[index] != FieldElement(0)) {
+                    if (accumulated[index].empty()) {
+                        accumulated[index].assign(staircase.size(), FieldElement(0));
+                    }
+                    for (size_t coordinate = 0; coordinate < staircase.size(); ++coordinate) {
+                        accumulated[index][coordinate] += rhs[index] * lhs[coordinate];
+                    }
+                }
+                if (index == 0 || accumulated[index].empty()) {
+                    continue;
+                }
+                auto product = multiplyByVariable(accumulated[index], predecessors[index].second);
+                accumulated[index] = Element();
+                auto& target = accumulated[predecessors[index].first];
+                if (target.empty()) {
+                    target = std::move(product);
+                } else {
+                    target = add(std::move(target), product);
+                }
+            }
+            if (staircase.empty() || accumulated[0].empty()) {
+                return Element(staircase.size(), FieldElement(0));
+            }
+            return std::move(accumulated[0]);
+        }
+
+        Element power(Element element, size_t exponent) const {
+            Element result = one();
+            while (exponent > 0) {
+                if (exponent % 2 == 1) {
+                    result = multiply(result, element);
+                }
+                exponent /= 2;
+                if (exponent > 0) {
+                    element = multiply(element, element);
+                }
+            }
+            return result;
+        }
+
+        // Solves element * x = 1 by Gaussian elimination on the matrix of multiplication by the element.
+        Element inverse(const Element& element) const {
+            auto columns = getStaircaseMultiples(element);
+            size_t dimension = staircase.size();
+            std::vector<Element> rows(dimension, Element(dimension + 1, FieldElement(0)));
+            auto unit = one();
+            for (size_t row = 0; row < dimension; ++row) {
+                for (size_t column = 0; column < dimension; ++column) {
+                    rows[row][column] = columns[column][row];
+                }
+                rows[row][dimension] = unit[row];
+            }
+            for (size_t column = 0; column < dimension; ++column) {
+                auto pivot = std::find_if(rows.begin() + column, rows.end(), [&](const Element& row) {
+                    return row[column] != FieldElement(0);
+                });
+                if (pivot == rows.end()) {
+                    throw std::runtime_error("Element is not invertible.");
+                }
+                std::swap(rows[column], *pivot);
+                FieldElement pivotValue = rows[column][column];
+                for (auto& value : rows[column]) {
+                    value /= pivotValue;
+                }
+                for (size_t row = 0; row < dimension; ++row) {
+                    if (row == column || rows[row][column] == FieldElement(0)) {
+                        continue;
+                    }
+                    FieldElement factor = rows[row][column];
+                    for (size_t index = column; index <= dimension; ++index) {
+                        rows[row][index] -= factor * rows[column][index];
+                    }
+                }
+            }
+            Element result(dimension);
+            for (size_t row = 0; row < dimension; ++row) {
+                result[row] = rows[row][dimension];
+            }
+            return result;
+        }
+
+        // Minimal polynomial of the element written in the variable with the given index. Powers of the element
+        // form a Krylov sequence, which is eliminated incrementally until the first linear dependency.
+        Poly minimalPolynomial(const Element& element, size_t variableIndex) const {
+            size_t dimension = staircase.size();
+            auto columns = getStaircaseMultiples(element);
+            // Reduced Krylov vectors with their pivots and the combinations of powers giving them.
+            std::vector<Element> reduced;
+            std::vector<size_t> pivots;
+            std::vector<Element> combinations;
+            Element current = one();
+            for (size_t degree = 0; degree <= dimension; ++degree) {
+                Element vector = current;
+                Element combination(degree + 1, FieldElement(0));
+                combination[degree] = FieldElement(1);
+                for (size_t index = 0; index < reduced.size(); ++index) {
+                    FieldElement factor = vector[pivots[index]];
+                    if (factor == FieldElement(0)) {
+                        continue;
+                    }
+                    for (size_t coordinate = 0; coordinate < dimension; ++coordinate) {
+                        vector[coordinate] -= factor * reduced[index][coordinate];
+                    }
+                    for (size_t power = 0; power < combinations[index].size(); ++power) {
+                        combination[power] -= factor * combinations[index][power];
+                    }
+                }
+                auto pivot = std::find_if(vector.begin(), vector.end(), [](const FieldElement& value) {
+                    return value != FieldElement(0);
+                });
+                if (pivot == vector.end()) {
+                    std::vector<typename Poly::Term> terms;
+                    for (size_t power = 0; power <= degree; ++power) {
+                        terms.emplace_back(Monomial::getNthVariable(variableIndex, power), combination[power]);
+                    }
+                    return Poly(terms.begin(), terms.end());
+                }
+                FieldElement pivotValue = *pivot;
+                for (auto& value : vector) {
+                    value /= pivotValue;
+                }
+                for (auto& value : combination) {
+                    value /= pivotValue;
+                }
+                pivots.push_back(pivot - vector.begin());
+                reduced.push_back(std::move(vector));
+                combinations.push_back(std::move(combination));
+                current = multiplyDense(columns, current);
+            }
+            throw std::runtime_error("Krylov sequence should become dependent within the dimension.");
+        }
+     private:
+        PolynomialSet<FieldElement, OrderType> basis;
+        size_t variablesCount = 0;
+        std::vector<Monomial> staircase;
+        std::map<Monomial, size_t, OrderAdaptor<OrderType>> staircaseIndices;
+        // Every normal monomial except 1 is a variable times a smaller normal monomial.
+        std::vector<std::pair<size_t, size_t>> predecessors;
+        // multiplicationMatrices[i][j] are the coordinates of x_i times the j-th normal monomial.
+        std::vector<std::vector<SparseColumn>> multiplicationMatrices;
+
+        bool isNormal(const Monomial& m) const {
+            return std::none_of(basis.begin(), basis.end(), [&](const Poly& p) {
+                return m.isDivisibleBy(Poly::getMonomial(p.leadingTerm()));
+            });
+        }
+
+        void checkZeroDimensional() const {
+            if (basis.empty()) {
+                throw std::runtime_error("Ideal should be zero-dimensional.");
+            }
+            for (size_t variableIndex = 0; variableIndex < variablesCount; ++variableIndex) {
+                bool hasPurePower = std::any_of(basis.begin(), basis.end(), [&](const Poly& p) {
+                    const auto& leadingMonomial = Poly::getMonomial(p.leadingTerm());
+                    return leadingMonomial == Monomial::getNthVariable(variableIndex, leadingMonomial.totalDegree());
+                });
+                if (!hasPurePower) {
+                    throw std::runtime_error("Ideal should be zero-dimensional.");
+                }
+            }
+        }
+
+        void buildStaircase() {
+            // Normal monomials with the variable they were reached by.
+            std::map<Monomial, size_t, OrderAdaptor<OrderType>> found;
+            std::deque<Monomial> queue;
+            if (isNormal(Monomial())) {
+                found.emplace(Monomial(), 0);
+                queue.push_back(Monomial());
+            }
+            while (!queue.empty()) {
+                Monomial m = std::move(queue.front());
+                queue.pop_front();
+                for (size_t variableIndex = 0; variableIndex < variablesCount; ++variableIndex) {
+                    Monomial next = m * Monomial::getNthVariable(variableIndex);
+                    if (!found.count(next) && isNormal(next)) {
+                        found.emplace(next, variableIndex);
+                        queue.push_back(std::move(next));
+                    }
+                }
+            }
+            for (const auto& position : found) {
+                staircaseIndices.emplace(position.first, staircase.size());
+                staircase.push_back(position.first);
+            }
+            predecessors.resize(staircase.size());
+            for (size_t index = 1; index < staircase.size(); ++index) {
+                size_t variableIndex = found.at(staircase[index]);
+                predecessors[index] = {staircaseIndices.at(staircase[index] / Monomial::getNthVariable(variableIndex)), variableIndex};
+            }
+        }
+
+        void buildMultiplicationMatrices() {
+            multiplicationMatrices.assign(variablesCount, std::vector<SparseColumn>(staircase.size()));
+            for (size_t variableIndex = 0; variableIndex < variablesCount; ++variableIndex) {
+                for (size_t column = 0; column < staircase.size(); ++column) {
+                    auto coordinates = toElement(Poly(staircase[column] * Monomial::getNthVariable(variableIndex)));
+                    for (size_t row = 0; row < staircase.size(); ++row) {
+                        if (coordinates[row] != FieldElement(0)) {
+                            multiplicationMatrices[variableIndex][column].emplace_back(row, coordinates[row]);
+                        }
+                    }
+                }
+            }
+        }
+
+        // The element times every normal monomial, which are the columns of the matrix of multiplication by it.
+        std::vector<Element> getStaircaseMultiples(const Element& element) const {
+            std::vector<Element> multiples(staircase.size());
+            if (staircase.empty()) {
+                return multiples;
+            }
+            multiples[0] = element;
+            for (size_t index = 1; index < staircase.size(); ++index) {
+                multiples[index] = multiplyByVariable(multiples[predecessors[index].first], predecessors[index].second);
+            }
+            return multiples;
+        }
+
+        Element multiplyDense(const std::vector<Element>& columns, const Element& element) const {
+            Element result(staircase.size(), FieldElement(0));
+            for (size_t column = 0; column < staircase.size(); ++column) {
+                if (element[column] == FieldElement(0)) {
+                    continue;
+                }
+                for (size_t row = 0; row < staircase.size(); ++row) {
+                    result[row] += columns[column][row] * element[column];
+                }
+            }
+            return result;
+        }
+    };
+}
+
+#endif //GROEBNER_QUOTIENT_RING_H
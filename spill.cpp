@@ -0,0 +1,65 @@
+#include "spill.h"
+#include <cstdlib>
+#include <filesystem>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace Groebner {
+    SpillFile::SpillFile(const std::string& directory) {
+        std::string path = (directory.empty() ? std::filesystem::temp_directory_path().string() : directory);
+        path += "/groebner-spill-XXXXXX";
+        descriptor = mkstemp(path.data());
+        if (descriptor == -1) {
+            throw std::runtime_error("Cannot create spill file in " + path + ".");
+        }
+        unlink(path.c_str());
+    }
+
+    SpillFile::~SpillFile() {
+        if (mapping != nullptr) {
+            munmap(mapping, capacity);
+        }
+        close(descriptor);
+    }
+
+    SpillRecord SpillFile::append(const std::vector<char>& bytes) {
+        reserve(used + bytes.size());
+        SpillRecord record{used, bytes.size()};
+        std::memcpy(mapping + used, bytes.data(), bytes.size());
+        used += bytes.size();
+        return record;
+    }
+
+    const char* SpillFile::getData(const SpillRecord& record) const {
+        return mapping + record.offset;
+    }
+
+    size_t SpillFile::getSize() const {
+        return used;
+    }
+
+    // Grows the file geometrically and maps it anew, the old mapping being dropped.
+    void SpillFile::reserve(size_t bytes) {
+        if (bytes <= capacity) {
+            return;
+        }
+        size_t newCapacity = std::max<size_t>(capacity * 2, 1 << 20);
+        while (newCapacity < bytes) {
+            newCapacity *= 2;
+        }
+        if (ftruncate(descriptor, static_cast<off_t>(newCapacity)) != 0) {
+            throw std::runtime_error("Cannot grow spill file.");
+        }
+        void* newMapping = mmap(nullptr, newCapacity, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+        if (newMapping == MAP_FAILED) {
+            throw std::runtime_error("Cannot map spill file.");
+        }
+        if (mapping != nullptr) {
+            munmap(mapping, capacity);
+        }
+        mapping = static_cast<char*>(newMapping);
+        capacity = newCapacity;
+    }
+}
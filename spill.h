@@ -0,0 +1,187 @@
+#ifndef GROEBNER_SPILL_H
+#define GROEBNER_SPILL_H
+
+#include "polynomial.h"
+#include "modular.h"
+#include <cstring>
+#include <deque>
+#include <string>
+#include <type_traits>
+
+namespace Groebner {
+    // Location of a record in a spill file.
+    struct SpillRecord {
+        size_t offset;
+        size_t size;
+    };
+
+    // Append-only temporary file mapped into memory. The mapping is shared, so the kernel may write its pages
+    // back to the file and drop them under memory pressure. The file is unlinked on creation and its space
+    // is given back when the object is destroyed.
+    class SpillFile {
+     public:
+        // Creates the file in the given directory, the system temporary directory if it is empty.
+        explicit SpillFile(const std::string& directory = "");
+        SpillFile(const SpillFile&) = delete;
+        SpillFile& operator=(const SpillFile&) = delete;
+        ~SpillFile();
+
+        SpillRecord append(const std::vector<char>& bytes);
+        // Stays valid until the next append, which may remap the file.
+        const char* getData(const SpillRecord& record) const;
+        size_t getSize() const;
+     private:
+        int descriptor = -1;
+        char* mapping = nullptr;
+        size_t capacity = 0;
+        size_t used = 0;
+
+        void reserve(size_t bytes);
+    };
+
+    inline void WriteVarint(uint64_t value, std::vector<char>* bytes) {
+        while (value >= 0x80) {
+            bytes->push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        bytes->push_back(static_cast<char>(value));
+    }
+
+    inline uint64_t ReadVarint(const char** position) {
+        uint64_t value = 0;
+        for (size_t shift = 0;; shift += 7) {
+            auto byte = static_cast<unsigned char>(*(*position)++);
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (byte < 0x80) {
+                return value;
+            }
+        }
+    }
+
+    // Packed form of coefficients in spilled polynomials.
+    template <typename FieldElement>
+    struct CoefficientCodec;
+
+    template <typename IntType>
+    struct CoefficientCodec<boost::rational<IntType>> {
+        static_assert(std::is_integral_v<IntType> && std::is_signed_v<IntType> && sizeof(IntType) <= sizeof(int64_t),
+                      "Only rationals over signed integers of at most 64 bits can be spilled, wider ones would be truncated.");
+
+        // Numerator in zigzag form, so small negative values stay short.
+        static void write(const boost::rational<IntType>& value, std::vector<char>* bytes) {
+            auto numerator = static_cast<int64_t>(value.numerator());
+            WriteVarint((static_cast<uint64_t>(numerator) << 1) ^ static_cast<uint64_t>(numerator >> 63), bytes);
+            WriteVarint(static_cast<uint64_t>(value.denominator()), bytes);
+        }
+
+        static boost::rational<IntType> read(const char** position) {
+            uint64_t zigzag = ReadVarint(position);
+            auto numerator = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+            auto denominator = static_cast<int64_t>(ReadVarint(position));
+            return boost::rational<IntType>(static_cast<IntType>(numerator), static_cast<IntType>(denominator));
+        }
+    };
+
+    // Residues are stored as they are, they should be read under the same modulus.
+    template <>
+    struct CoefficientCodec<Modular> {
+        static void write(const Modular& value, std::vector<char>* bytes) {
+            WriteVarint(value.getValue(), bytes);
+        }
+
+        static Modular read(const char** position) {
+            return Modular(static_cast<long long>(ReadVarint(position)));
+        }
+    };
+
+    // Terms in increasing order, each as the length of its exponent vector, the exponents and the coefficient.
+    template <typename FieldElement, typename OrderType>
+    void PackPolynomial(const Polynomial<FieldElement, OrderType>& p, std::vector<char>* bytes) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        WriteVarint(p.size(), bytes);
+        for (const auto& term : p) {
+            const auto& monomial = Poly::getMonomial(term);
+            WriteVarint(monomial.greatestVariableIndex(), bytes);
+            for (size_t variableIndex = 0; variableIndex < monomial.greatestVariableIndex(); ++variableIndex) {
+                WriteVarint(monomial.degree(variableIndex), bytes);
+            }
+            CoefficientCodec<FieldElement>::write(Poly::getCoefficient(term), bytes);
+        }
+    }
+
+    template <typename FieldElement, typename OrderType>
+    Polynomial<FieldElement, OrderType> UnpackPolynomial(const char* position) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        std::vector<typename Poly::Term> terms;
+        size_t termsCount = ReadVarint(&position);
+        terms.reserve(termsCount);
+        while (terms.size() < termsCount) {
+            Monomial::DegreeContainer degrees(ReadVarint(&position));
+            for (auto& degree : degrees) {
+                degree = ReadVarint(&position);
+            }
+            terms.emplace_back(Monomial(std::move(degrees)), CoefficientCodec<FieldElement>::read(&position));
+        }
+        return Poly(terms.begin(), terms.end());
+    }
+
+    // FIFO queue of trivially copyable values. Pushes go to the tail chunk and pops come from the head one;
+    // full tail chunks are written to the spill file while the queue takes more than residentLimit bytes.
+    template <typename T>
+    class SpilledQueue {
+        static_assert(std::is_trivially_copyable_v<T>, "Spilled values are copied bytewise.");
+     public:
+        SpilledQueue(SpillFile* file, size_t residentLimit, size_t chunkSize = 1 << 16)
+            : file(file), residentLimit(residentLimit), chunkSize(chunkSize) {}
+
+        void push(const T& value) {
+            tail.push_back(value);
+            if (tail.size() >= chunkSize && (head.size() - headPosition + tail.size()) * sizeof(T) > residentLimit) {
+                std::vector<char> bytes(tail.size() * sizeof(T));
+                std::memcpy(bytes.data(), tail.data(), bytes.size());
+                chunks.push_back(file->append(bytes));
+                tail.clear();
+            }
+            ++count;
+        }
+
+        T pop() {
+            if (headPosition == head.size()) {
+                headPosition = 0;
+                if (chunks.empty()) {
+                    head.swap(tail);
+                    tail.clear();
+                } else {
+                    head.resize(chunks.front().size / sizeof(T));
+                    std::memcpy(static_cast<void*>(head.data()), file->getData(chunks.front()), chunks.front().size);
+                    chunks.pop_front();
+                }
+            }
+            --count;
+            return head[headPosition++];
+        }
+
+        size_t size() const {
+            return count;
+        }
+
+        bool empty() const {
+            return count == 0;
+        }
+
+        size_t getSpilledChunksCount() const {
+            return chunks.size();
+        }
+     private:
+        SpillFile* file;
+        size_t residentLimit;
+        size_t chunkSize;
+        std::vector<T> head;
+        size_t headPosition = 0;
+        std::deque<SpillRecord> chunks;
+        std::vector<T> tail;
+        size_t count = 0;
+    };
+}
+
+#endif //GROEBNER_SPILL_H
@@ -0,0 +1,70 @@
+#include "symmetry.h"
+#include <map>
+
+namespace Groebner {
+    namespace {
+        Permutation composePermutations(const Permutation& first, const Permutation& second) {
+            Permutation result(second.size());
+            for (size_t variableIndex = 0; variableIndex < second.size(); ++variableIndex) {
+                result[variableIndex] = first[second[variableIndex]];
+            }
+            return result;
+        }
+    }
+
+    PermutationGroup::PermutationGroup(const std::vector<Permutation>& generators) {
+        size_t variablesCount = (generators.empty() ? 0 : generators.front().size());
+        for (const auto& generator : generators) {
+            Permutation sorted(generator);
+            std::sort(sorted.begin(), sorted.end());
+            if (generator.size() != variablesCount || std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()
+                || (!sorted.empty() && sorted.back() >= variablesCount)) {
+                throw std::runtime_error("Generators should be permutations of the same variables.");
+            }
+        }
+
+        Permutation identity(variablesCount);
+        std::iota(identity.begin(), identity.end(), 0);
+        std::map<Permutation, size_t> indices{{identity, 0}};
+        elements.push_back(std::move(identity));
+        for (size_t current = 0; current < elements.size(); ++current) {
+            for (const auto& generator : generators) {
+                auto product = composePermutations(generator, elements[current]);
+                if (indices.emplace(product, elements.size()).second) {
+                    elements.push_back(std::move(product));
+                }
+            }
+        }
+
+        compositionTable.assign(elements.size(), std::vector<size_t>(elements.size()));
+        for (size_t first = 0; first < elements.size(); ++first) {
+            for (size_t second = 0; second < elements.size(); ++second) {
+                compositionTable[first][second] = indices.at(composePermutations(elements[first], elements[second]));
+            }
+        }
+    }
+
+    size_t PermutationGroup::size() const {
+        return elements.size();
+    }
+
+    const Permutation& PermutationGroup::operator[](size_t index) const {
+        return elements[index];
+    }
+
+    size_t PermutationGroup::compose(size_t first, size_t second) const {
+        return compositionTable[first][second];
+    }
+
+    size_t PermutationGroup::inverse(size_t index) const {
+        return std::find(compositionTable[index].begin(), compositionTable[index].end(), 0) - compositionTable[index].begin();
+    }
+
+    PermutationGroup PermutationGroup::cyclic(size_t variablesCount) {
+        Permutation shift(variablesCount);
+        for (size_t variableIndex = 0; variableIndex < variablesCount; ++variableIndex) {
+            shift[variableIndex] = (variableIndex + 1) % variablesCount;
+        }
+        return PermutationGroup({shift});
+    }
+}
@@ -0,0 +1,245 @@
+#ifndef GROEBNER_SYMMETRY_H
+#define GROEBNER_SYMMETRY_H
+
+#include "algorithm.h"
+#include <limits>
+#include <set>
+#include <unordered_map>
+
+namespace Groebner {
+    // Permutation of variables: the variable with index i is sent to the variable with index permutation[i].
+    using Permutation = std::vector<size_t>;
+
+    class PermutationGroup {
+     public:
+        explicit PermutationGroup(const std::vector<Permutation>& generators);
+
+        size_t size() const;
+        const Permutation& operator[](size_t index) const;
+
+        // Index of the permutation applying the second one first and the first one afterwards.
+        size_t compose(size_t first, size_t second) const;
+        size_t inverse(size_t index) const;
+
+        static PermutationGroup cyclic(size_t variablesCount);
+     private:
+        std::vector<Permutation> elements;
+        std::vector<std::vector<size_t>> compositionTable;
+    };
+
+    template <typename FieldElement, typename OrderType>
+    Polynomial<FieldElement, OrderType> ApplyPermutation(const Polynomial<FieldElement, OrderType>& p,
+                                                         const Permutation& permutation) {
+        return RenameVariables(p, permutation);
+    }
+
+    inline Monomial ApplyPermutation(const Monomial& m, const Permutation& permutation) {
+        Monomial::DegreeContainer degrees(permutation.size(), 0);
+        for (size_t variableIndex = 0; variableIndex < m.greatestVariableIndex(); ++variableIndex) {
+            degrees[permutation[variableIndex]] += m.degree(variableIndex);
+        }
+        return Monomial(std::move(degrees));
+    }
+
+    // Buchberger algorithm for an ideal invariant under the given group of variable permutations.
+    // Every new remainder brings the images of itself whose leading terms are not reducible yet.
+    // Once a pair is reduced, its images under the group are skipped whenever the image of the
+    // recorded reduction consists of basis elements and stays below the lcm of the image pair,
+    // which keeps the result a Groebner basis by the lcm-representation form of the Buchberger criterion.
+    // The ideal should be invariant, otherwise the constructor throws rather than compute the basis
+    // of the ideal generated by the orbits. Images of the generators are first reduced over the interreduced
+    // generators; only if some image does not vanish, the generators are completed to a Groebner basis
+    // by DoBuhberger, over which the remainders decide invariance.
+    template <typename FieldElement, typename OrderType>
+    class SymmetricBasis {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        using Pair = std::pair<size_t, size_t>;
+        using ReductionStep = std::pair<Monomial, size_t>;
+     public:
+        SymmetricBasis(const PolynomialSet<FieldElement, OrderType>& generators, const PermutationGroup& group)
+            : group(group)
+        {
+            auto reducedGenerators = generators;
+            ReduceSetOverItselfWhilePossible(&reducedGenerators);
+            if (!areImagesReducedToZero(generators, reducedGenerators)) {
+                DoBuhberger(&reducedGenerators);
+                if (!areImagesReducedToZero(generators, reducedGenerators)) {
+                    throw std::runtime_error("Generators should be invariant under the group.");
+                }
+            }
+            for (const auto& generator : reducedGenerators) {
+                auto p = generator;
+                ReduceOverSetWhilePossible(elements, &p);
+                if (p != FieldElement(0)) {
+                    insertOrbit(p);
+                }
+            }
+        }
+
+        void compute() {
+            while (!pendingPairs.empty()) {
+                Pair pair = pendingPairs.begin()->second;
+                pendingPairs.erase(pendingPairs.begin());
+                if (donePairs.count(pair)) {
+                    continue;
+                }
+                processPair(pair);
+            }
+        }
+
+        size_t getSkippedPairsCount() const {
+            return skippedPairsCount;
+        }
+
+        PolynomialSet<FieldElement, OrderType> getBasis() const {
+            return PolynomialSet<FieldElement, OrderType>(elements.begin(), elements.end());
+        }
+     private:
+        static constexpr size_t NoImage = std::numeric_limits<size_t>::max();
+
+        PermutationGroup group;
+        std::vector<Poly> elements;
+        std::unordered_map<Poly, size_t, boost::hash<Poly>> elementIndices;
+        // images[i][k] is the index of the k-th permutation applied to the i-th element, if it is in the basis.
+        std::vector<std::vector<size_t>> images;
+        std::multimap<size_t, Pair> pendingPairs;
+        std::set<Pair> donePairs;
+        size_t skippedPairsCount = 0;
+
+        bool areImagesReducedToZero(const PolynomialSet<FieldElement, OrderType>& generators,
+                                    const PolynomialSet<FieldElement, OrderType>& reducers) const {
+            for (const auto& generator : generators) {
+                for (size_t k = 1; k < group.size(); ++k) {
+                    auto image = ApplyPermutation(generator, group[k]);
+                    ReduceOverSetWhilePossible(reducers, &image);
+                    if (image != FieldElement(0)) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        static const Monomial& getLeadingMonomial(const Poly& p) {
+            return Poly::getMonomial(p.leadingTerm());
+        }
+
+        static Pair makePair(size_t first, size_t second) {
+            return {std::min(first, second), std::max(first, second)};
+        }
+
+        size_t findElement(Poly p) const {
+            p.normalize();
+            auto found = elementIndices.find(p);
+            return (found == elementIndices.end() ? NoImage : found->second);
+        }
+
+        bool isTopReducible(const Poly& p) const {
+            return std::any_of(elements.begin(), elements.end(), [&](const Poly& element) {
+                return getLeadingMonomial(p).isDivisibleBy(getLeadingMonomial(element));
+            });
+        }
+
+        size_t insertOrbit(const Poly& p) {
+            size_t index = insertElement(p);
+            for (size_t k = 1; k < group.size(); ++k) {
+                auto image = ApplyPermutation(p, group[k]);
+                if (!isTopReducible(image)) {
+                    insertElement(std::move(image));
+                }
+            }
+            return index;
+        }
+
+        size_t insertElement(Poly p) {
+            p.normalize();
+            size_t index = elements.size();
+            for (size_t other = 0; other < index; ++other) {
+                if (!AreLeadingTermsCoPrime(elements[other], p)) {
+                    auto lcmDegree = lcm(getLeadingMonomial(elements[other]), getLeadingMonomial(p)).totalDegree();
+                    pendingPairs.emplace(lcmDegree, Pair(other, index));
+                }
+            }
+            elementIndices.emplace(p, index);
+            elements.push_back(std::move(p));
+            images.emplace_back(group.size(), NoImage);
+            for (size_t k = 0; k < group.size(); ++k) {
+                images[index][k] = findElement(ApplyPermutation(elements[index], group[k]));
+                size_t preimage = findElement(ApplyPermutation(elements[index], group[group.inverse(k)]));
+                if (preimage != NoImage) {
+                    images[preimage][k] = index;
+                }
+            }
+            return index;
+        }
+
+        void reduceRecording(Poly* g, std::vector<ReductionStep>* steps) const {
+            bool reduced = true;
+            while (reduced && *g != FieldElement(0)) {
+                reduced = false;
+                for (size_t index = 0; index < elements.size(); ++index) {
+                    const auto& leadingMonomial = getLeadingMonomial(elements[index]);
+                    auto divisibleTermPtr = std::find_if(g->begin(), g->end(), [&](const typename Poly::Term& t) {
+                        return Poly::getMonomial(t).isDivisibleBy(leadingMonomial);
+                    });
+                    if (divisibleTermPtr == g->end()) {
+                        continue;
+                    }
+                    Monomial monomialQuotient = Poly::getMonomial(*divisibleTermPtr) / leadingMonomial;
+                    g->subtractMultiple(monomialQuotient, Poly::getCoefficient(*divisibleTermPtr), elements[index]);
+                    steps->emplace_back(std::move(monomialQuotient), index);
+                    reduced = true;
+                }
+            }
+        }
+
+        void processPair(const Pair& pair) {
+            donePairs.insert(pair);
+            std::vector<ReductionStep> steps;
+            auto S = S_Polynomial(elements[pair.first], elements[pair.second]);
+            reduceRecording(&S, &steps);
+            if (S != FieldElement(0)) {
+                steps.emplace_back(Monomial(), insertOrbit(S));
+            }
+            Monomial pairLcm = lcm(getLeadingMonomial(elements[pair.first]), getLeadingMonomial(elements[pair.second]));
+            for (size_t k = 1; k < group.size(); ++k) {
+                size_t first = images[pair.first][k];
+                size_t second = images[pair.second][k];
+                if (first == NoImage || second == NoImage || first == second || donePairs.count(makePair(first, second))) {
+                    continue;
+                }
+                if (isImageRepresentationStandard(pair, pairLcm, steps, k)) {
+                    donePairs.insert(makePair(first, second));
+                    ++skippedPairsCount;
+                }
+            }
+        }
+
+        bool isImageRepresentationStandard(const Pair& pair, const Monomial& pairLcm,
+                                           const std::vector<ReductionStep>& steps, size_t k) const {
+            const auto& permutation = group[k];
+            for (size_t index : {pair.first, pair.second}) {
+                if (getLeadingMonomial(elements[images[index][k]]) != ApplyPermutation(getLeadingMonomial(elements[index]), permutation)) {
+                    return false;
+                }
+            }
+            Monomial imageLcm = ApplyPermutation(pairLcm, permutation);
+            return std::all_of(steps.begin(), steps.end(), [&](const ReductionStep& step) {
+                size_t imageIndex = images[step.second][k];
+                return imageIndex != NoImage &&
+                       OrderType::isLess(ApplyPermutation(step.first, permutation) * getLeadingMonomial(elements[imageIndex]), imageLcm);
+            });
+        }
+    };
+
+    template <typename FieldElement, typename OrderType>
+    void DoSymmetricBuhberger(PolynomialSet<FieldElement, OrderType>* set, const PermutationGroup& group) {
+        SymmetricBasis<FieldElement, OrderType> basis(*set, group);
+        basis.compute();
+        *set = basis.getBasis();
+        ReduceSetOverItselfWhilePossible(set);
+        LeadingTermToOne(set);
+    }
+}
+
+#endif //GROEBNER_SYMMETRY_H
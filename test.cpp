@@ -82,6 +82,26 @@ namespace Groebner {
         if (!DegreeLexOrder::isLess(A, D)) {
             throw std::runtime_error("Wrong degree-lexicographical compare");
         }
+
+        auto restrict = [](const Monomial& m, size_t firstVariable, size_t lastVariable) {
+            Monomial::DegreeContainer degrees(std::min(lastVariable, m.greatestVariableIndex()), 0);
+            for (size_t variableIndex = firstVariable; variableIndex < degrees.size(); ++variableIndex) {
+                degrees[variableIndex] = m.degree(variableIndex);
+            }
+            return Monomial(std::move(degrees));
+        };
+        BlockSizeScope scope(1);
+        for (size_t attempt = 0; attempt < 1000; ++attempt) {
+            Monomial lhs = random_monomial();
+            Monomial rhs = random_monomial();
+            bool isFirstBlockLess = DegreeRevLexOrder::isLess(restrict(lhs, 0, 1), restrict(rhs, 0, 1));
+            bool isFirstBlockGreater = DegreeRevLexOrder::isLess(restrict(rhs, 0, 1), restrict(lhs, 0, 1));
+            bool isLess = isFirstBlockLess || (!isFirstBlockGreater && DegreeRevLexOrder::isLess(restrict(lhs, 1, 3), restrict(rhs, 1, 3)));
+            if (BlockOrder<1>::isLess(lhs, rhs) != isLess || RuntimeBlockOrder::isLess(lhs, rhs) != isLess
+                || Restriction<1, 3, LexOrder>::isLess(lhs, rhs) != LexOrder::isLess(restrict(lhs, 1, 3), restrict(rhs, 1, 3))) {
+                throw std::runtime_error("Block order should compare the restricted monomials.");
+            }
+        }
     }
 
     void test_polynomials() {
@@ -126,6 +146,25 @@ namespace Groebner {
         if (x + x != x + Monomial({1})) {
             throw std::runtime_error("Addition with monomial does not work as intended");
         }
+
+        auto polyC = polyA;
+        polyC.addMultiple(Monomial({1}), 2, polyB);
+        if (polyC != polyA + Polynomial<int, DegreeLexOrder>({{Monomial({1}), 2}}) * polyB) {
+            throw std::runtime_error("Polynomial addMultiple does not work as intended");
+        }
+        polyC = polyA;
+        polyC.multiplyByTerm(Monomial({0, 1}), -3);
+        if (polyC != Polynomial<int, DegreeLexOrder>({{Monomial({0, 1}), -3}}) * polyA) {
+            throw std::runtime_error("Polynomial multiplyByTerm does not work as intended");
+        }
+        polyC = polyA;
+        if (polyC.negate().scale(2) != Polynomial<int, DegreeLexOrder>(-2) * polyA || polyC.scale(0) != zero2) {
+            throw std::runtime_error("Polynomial scale and negate do not work as intended");
+        }
+        Polynomial<boost::rational<long long>, DegreeLexOrder> polyD({{Monomial({1}), 3}, {Monomial(), 2}});
+        if (polyD.normalize() != Polynomial<boost::rational<long long>, DegreeLexOrder>({{Monomial({1}), 1}, {Monomial(), boost::rational<long long>(2, 3)}})) {
+            throw std::runtime_error("Polynomial normalize does not work as intended");
+        }
     }
 
     void test_algorithm_lex() {
@@ -231,6 +270,8 @@ namespace Groebner {
     }
 
     void test_algorithm_cyclic() {
+        // Polynomials are only moved inside the algorithm, every arithmetic step works in place.
+        const size_t MaxCopiesPerRun = 0;
         std::cout << std::string(80, '=') << std::endl;
         for (size_t i = 1; i <= 10; ++i) {
             auto familyLex = GenerateCyclicFamily<Groebner::LexOrder>(i);
@@ -241,11 +282,15 @@ namespace Groebner {
 
                 auto defAnchor = RationalPolynomialLex::countDefaultCTors();
                 auto copyAnchor = RationalPolynomialLex::countCopyCTors();
-                auto copyAssignAnchor = RationalPolynomialLex::countMoveAsgnmts();
+                auto copyAssignAnchor = RationalPolynomialLex::countCopyAsgnmts();
                 auto moveAnchor = RationalPolynomialLex::countMoveCTors();
                 auto moveAssignAnchor = RationalPolynomialLex::countMoveAsgnmts();
                 auto dtorsAnchor = RationalPolynomialLex::countDestructors();
                 Groebner::DoBuhberger(&familyLex);
+                if (RationalPolynomialLex::countCopyCTors() - copyAnchor > MaxCopiesPerRun
+                    || RationalPolynomialLex::countCopyAsgnmts() - copyAssignAnchor > MaxCopiesPerRun) {
+                    throw std::runtime_error("Buchberger algorithm should not copy polynomials.");
+                }
             }
             auto familyRevLex = GenerateCyclicFamily<Groebner::DegreeRevLexOrder>(i);
             {
@@ -255,11 +300,15 @@ namespace Groebner {
 
                 auto defAnchor = RationalPolynomialDegRevLex::countDefaultCTors();
                 auto copyAnchor = RationalPolynomialDegRevLex::countCopyCTors();
-                auto copyAssignAnchor = RationalPolynomialDegRevLex::countMoveAsgnmts();
+                auto copyAssignAnchor = RationalPolynomialDegRevLex::countCopyAsgnmts();
                 auto moveAnchor = RationalPolynomialDegRevLex::countMoveCTors();
                 auto moveAssignAnchor = RationalPolynomialDegRevLex::countMoveAsgnmts();
                 auto dtorsAnchor = RationalPolynomialDegRevLex::countDestructors();
                 Groebner::DoBuhberger(&familyRevLex);
+                if (RationalPolynomialDegRevLex::countCopyCTors() - copyAnchor > MaxCopiesPerRun
+                    || RationalPolynomialDegRevLex::countCopyAsgnmts() - copyAssignAnchor > MaxCopiesPerRun) {
+                    throw std::runtime_error("Buchberger algorithm should not copy polynomials.");
+                }
             }
 
             {
@@ -278,12 +327,16 @@ namespace Groebner {
 
                 auto defAnchor = RationalPolynomialLex::countDefaultCTors();
                 auto copyAnchor = RationalPolynomialLex::countCopyCTors();
-                auto copyAssignAnchor = RationalPolynomialLex::countMoveAsgnmts();
+                auto copyAssignAnchor = RationalPolynomialLex::countCopyAsgnmts();
                 auto moveAnchor = RationalPolynomialLex::countMoveCTors();
                 auto moveAssignAnchor = RationalPolynomialLex::countMoveAsgnmts();
                 auto dtorsAnchor = RationalPolynomialLex::countDestructors();
                 Groebner::DoBuhberger(&familyLex2);
-                if (familyLex != familyLex2) {
+                if (RationalPolynomialLex::countCopyCTors() - copyAnchor > MaxCopiesPerRun
+                    || RationalPolynomialLex::countCopyAsgnmts() - copyAssignAnchor > MaxCopiesPerRun) {
+                    throw std::runtime_error("Buchberger algorithm should not copy polynomials.");
+                }
+                if (!AreEqualBases(familyLex, familyLex2)) {
                     throw std::runtime_error("Sets should be equal.");
                 }
             }
@@ -294,12 +347,988 @@ namespace Groebner {
         }
     }
 
+    void test_truncated() {
+        for (size_t n = 1; n <= 5; ++n) {
+            auto symmetricFamily = GenerateSymmetricFamily<DegreeRevLexOrder>(GeneratePowerFamily<DegreeRevLexOrder>(n));
+            RationalPolynomialSet<DegreeRevLexOrder> ideal(symmetricFamily.begin() + 1, symmetricFamily.end());
+            auto fullBasis = ideal;
+            DoBuhberger(&fullBasis);
+
+            TruncatedBasis<Rational, DegreeRevLexOrder> truncated(ideal);
+            if (truncated.computeUpToDegree(n - 1)) {
+                throw std::runtime_error("Truncated basis should not be complete before the top degree.");
+            }
+            for (const auto& elem : truncated.getBasis()) {
+                if (RationalPolynomialDegRevLex::getMonomial(elem.leadingTerm()).totalDegree() >= n) {
+                    throw std::runtime_error("Truncated basis should not contain elements above the degree bound.");
+                }
+            }
+            if (!truncated.computeUpToDegree(n * n)) {
+                throw std::runtime_error("Resumed truncated basis should be complete.");
+            }
+            if (truncated.getReducedBasis() != fullBasis) {
+                throw std::runtime_error("Complete truncated basis should match the full basis.");
+            }
+        }
+    }
+
+    void test_elimination() {
+        using Poly = Polynomial<Rational, LexOrder>;
+        using PolyDRL = Polynomial<Rational, DegreeRevLexOrder>;
+        Poly a(Monomial({1}));
+        Poly b(Monomial({0, 1}));
+        Poly c(Monomial({0, 0, 1}));
+        Poly one(Rational(1));
+
+        PolynomialSet<Rational, LexOrder> ideal({a * a + b * b + c * c - one, a * a + c * c - b, a - c});
+        auto lexBasis = ideal;
+        DoBuhberger(&lexBasis);
+        PolynomialSet<Rational, DegreeRevLexOrder> expected;
+        for (const auto& p : lexBasis) {
+            if (!DependsOnFirstVariables(p, 1)) {
+                expected.insert(ChangeOrder<DegreeRevLexOrder>(p));
+            }
+        }
+        DoBuhberger(&expected);
+        LeadingTermToOne(&expected);
+        if (EliminateFirstVariables<1>(ideal) != expected || EliminateVariables(ideal, {0}) != expected) {
+            throw std::runtime_error("Elimination ideal should match the filtered Lex basis.");
+        }
+
+        PolyDRL x(Monomial({1}));
+        PolyDRL y(Monomial({0, 1}));
+        PolyDRL z(Monomial({0, 0, 1}));
+        auto eliminated = EliminateVariables(PolynomialSet<Rational, DegreeRevLexOrder>({x - y * y, z - y * y * y}), {1});
+        if (eliminated != PolynomialSet<Rational, DegreeRevLexOrder>({x * x * x - z * z})) {
+            throw std::runtime_error("Elimination of the middle variable failed.");
+        }
+        PolyDRL u(Monomial({0, 0, 0, 1}));
+        PolyDRL v(Monomial({0, 0, 0, 0, 1}));
+        eliminated = EliminateVariables(PolynomialSet<Rational, DegreeRevLexOrder>({y - x * x, u - x * z, v - z * z}), {2, 0});
+        if (eliminated != PolynomialSet<Rational, DegreeRevLexOrder>({u * u - y * v})) {
+            throw std::runtime_error("Elimination of several variables failed.");
+        }
+
+        auto intersection = IntersectIdeals(PolynomialSet<Rational, DegreeRevLexOrder>({x * y}),
+                                            PolynomialSet<Rational, DegreeRevLexOrder>({y * z}));
+        if (intersection != PolynomialSet<Rational, DegreeRevLexOrder>({x * y * z})) {
+            throw std::runtime_error("Intersection of ideals failed.");
+        }
+
+        auto saturation = Saturate(PolynomialSet<Rational, DegreeRevLexOrder>({x * x * y, x * z}), x);
+        if (saturation != PolynomialSet<Rational, DegreeRevLexOrder>({y, z})) {
+            throw std::runtime_error("Saturation of ideal failed.");
+        }
+    }
+
+    void test_symmetry() {
+        for (size_t n = 1; n <= 6; ++n) {
+            auto group = PermutationGroup::cyclic(n);
+            if (group.size() != n) {
+                throw std::runtime_error("Cyclic group has wrong order.");
+            }
+            auto familyRevLex = GenerateCyclicFamily<DegreeRevLexOrder>(n);
+            auto symmetricRevLex = familyRevLex;
+            DoBuhberger(&familyRevLex);
+            LeadingTermToOne(&familyRevLex);
+            DoSymmetricBuhberger(&symmetricRevLex, group);
+            if (familyRevLex != symmetricRevLex) {
+                throw std::runtime_error("Symmetric computation should give the same reduced basis.");
+            }
+
+            auto familyLex = GenerateCyclicFamily<LexOrder>(n);
+            auto symmetricLex = familyLex;
+            DoBuhberger(&familyLex);
+            LeadingTermToOne(&familyLex);
+            DoSymmetricBuhberger(&symmetricLex, group);
+            if (familyLex != symmetricLex) {
+                throw std::runtime_error("Symmetric computation should give the same reduced basis.");
+            }
+
+            SymmetricBasis<Rational, DegreeRevLexOrder> basis(GenerateCyclicFamily<DegreeRevLexOrder>(n), PermutationGroup::cyclic(n));
+            basis.compute();
+            if (n >= 3 && basis.getSkippedPairsCount() == 0) {
+                throw std::runtime_error("Images of reduced pairs should be skipped.");
+            }
+        }
+
+        using Poly = Polynomial<Rational, DegreeRevLexOrder>;
+        Poly x(Monomial({1}));
+        Poly y(Monomial({0, 1}));
+        bool isThrown = false;
+        try {
+            SymmetricBasis<Rational, DegreeRevLexOrder> basis(PolynomialSet<Rational, DegreeRevLexOrder>({x * x - y}), PermutationGroup::cyclic(2));
+        } catch (const std::runtime_error&) {
+            isThrown = true;
+        }
+        if (!isThrown) {
+            throw std::runtime_error("Non-invariant generators should be rejected.");
+        }
+
+        // Invariant, as y^2 + x = (1 + x^3) / x^2 is in the ideal, but the image does not reduce over the generators.
+        using PolyLex = Polynomial<Rational, LexOrder>;
+        PolyLex xLex(Monomial({1}));
+        PolyLex yLex(Monomial({0, 1}));
+        PolynomialSet<Rational, LexOrder> swapInvariant({xLex * yLex - PolyLex(Rational(1)), xLex * xLex + yLex});
+        auto swapInvariantBasis = swapInvariant;
+        DoBuhberger(&swapInvariantBasis);
+        LeadingTermToOne(&swapInvariantBasis);
+        DoSymmetricBuhberger(&swapInvariant, PermutationGroup::cyclic(2));
+        if (swapInvariant != swapInvariantBasis) {
+            throw std::runtime_error("Invariance should be checked against a Groebner basis.");
+        }
+    }
+
+    void test_control() {
+        auto fullBasis = GenerateCyclicFamily<DegreeRevLexOrder>(5);
+        DoBuhberger(&fullBasis);
+        LeadingTermToOne(&fullBasis);
+
+        auto checkPartialBasis = [&](RationalPolynomialSet<DegreeRevLexOrder> partialBasis) {
+            DoBuhberger(&partialBasis);
+            LeadingTermToOne(&partialBasis);
+            if (partialBasis != fullBasis) {
+                throw std::runtime_error("Partial basis should generate the same ideal.");
+            }
+        };
+
+        CancellationToken token;
+        token.cancel();
+        BuhbergerOptions cancelled;
+        cancelled.cancellationToken = &token;
+        auto family = GenerateCyclicFamily<DegreeRevLexOrder>(5);
+        if (DoBuhberger(&family, cancelled) != BuhbergerStatus::Cancelled) {
+            throw std::runtime_error("Cancelled computation should report cancellation.");
+        }
+        checkPartialBasis(family);
+        auto generators = GenerateCyclicFamily<DegreeRevLexOrder>(5);
+        LeadingTermToOne(&generators);
+        if (family != generators) {
+            throw std::runtime_error("Cancelled computation should stop before the interreduction.");
+        }
+
+        BuhbergerOptions expired;
+        expired.deadline = std::chrono::steady_clock::now();
+        family = GenerateCyclicFamily<DegreeRevLexOrder>(5);
+        if (DoBuhberger(&family, expired) != BuhbergerStatus::DeadlineExceeded) {
+            throw std::runtime_error("Expired computation should report the deadline.");
+        }
+        checkPartialBasis(family);
+
+        MemoryBudget budget(1000);
+        BuhbergerOptions limited;
+        limited.memoryBudget = &budget;
+        family = GenerateCyclicFamily<DegreeRevLexOrder>(5);
+        if (DoBuhberger(&family, limited) != BuhbergerStatus::MemoryBudgetExceeded) {
+            throw std::runtime_error("Computation over the budget should report it.");
+        }
+        if (budget.getUsed() != 0) {
+            throw std::runtime_error("Memory should be released after the computation.");
+        }
+        checkPartialBasis(family);
+
+        size_t progressReports = 0;
+        BuhbergerOptions observed;
+        observed.progressCallback = [&](const BuhbergerProgress& progress) {
+            if (progress.basisSize == 0 || progress.currentDegree == 0) {
+                throw std::runtime_error("Progress should describe the current pair.");
+            }
+            ++progressReports;
+        };
+        family = GenerateCyclicFamily<DegreeRevLexOrder>(5);
+        if (DoBuhberger(&family, observed) != BuhbergerStatus::Completed || progressReports == 0) {
+            throw std::runtime_error("Observed computation should complete and report progress.");
+        }
+        LeadingTermToOne(&family);
+        if (family != fullBasis) {
+            throw std::runtime_error("Observed computation should give the same basis.");
+        }
+
+        BuhbergerOptions topOnly;
+        topOnly.reductionMode = ReductionMode::TopOnly;
+        family = GenerateCyclicFamily<DegreeRevLexOrder>(5);
+        if (DoBuhberger(&family, topOnly) != BuhbergerStatus::Completed || family != fullBasis) {
+            throw std::runtime_error("Top reduction should give the same reduced basis.");
+        }
+        for (size_t n = 2; n <= 4; ++n) {
+            auto familyLex = GenerateCyclicFamily<LexOrder>(n);
+            auto familyLexTopOnly = familyLex;
+            DoBuhberger(&familyLex);
+            DoBuhberger(&familyLexTopOnly, topOnly);
+            if (!AreEqualBases(familyLex, familyLexTopOnly)) {
+                throw std::runtime_error("Top reduction should give the same reduced basis.");
+            }
+        }
+    }
+
+    void test_batch() {
+        auto family = GenerateCyclicFamily<LexOrder>(4);
+        DoBuhberger(&family);
+        for (const auto& p : family) {
+            std::ostringstream os;
+            os << p;
+            if (ParsePolynomial<Rational, LexOrder>(os.str()) != p) {
+                throw std::runtime_error("Printed polynomial should be parsed back.");
+            }
+        }
+        Polynomial<Rational, LexOrder> a(Monomial({1}));
+        Polynomial<Rational, LexOrder> c(Monomial({0, 0, 1}));
+        if (ParsePolynomial<Rational, LexOrder>("a^2*c - 3/2 c + 1 - a") != a * a * c - Rational(3, 2) * c + Rational(1) - a) {
+            throw std::runtime_error("Polynomial parser does not work as intended");
+        }
+        if (ParsePolynomial<Rational, LexOrder>("9223372036854775807 a") != Rational(std::numeric_limits<long long>::max()) * a) {
+            throw std::runtime_error("Largest coefficient should be parsed.");
+        }
+        if (SolveBatchJob(0, ParseBatchJob("lex rational: 12345678901234567890 a - b")).error.find("Can't parse") == std::string::npos) {
+            throw std::runtime_error("Coefficients out of range should be rejected.");
+        }
+
+        std::vector<BatchJob> jobs;
+        for (size_t n = 1; n <= 6; ++n) {
+            std::vector<std::string> generators;
+            for (const auto& p : GenerateCyclicFamily<DegreeRevLexOrder>(n)) {
+                std::ostringstream os;
+                os << p;
+                generators.push_back(os.str());
+            }
+            BatchJob job;
+            job.order = (n % 2 == 0 ? "lex" : "degrevlex");
+            job.coefficients = "rational";
+            job.generators = std::move(generators);
+            jobs.push_back(std::move(job));
+        }
+        jobs.push_back(ParseBatchJob("deglex rational: ac - b^2, a^3 - c^2"));
+        jobs.push_back(ParseBatchJob("unknown rational: a"));
+
+        for (auto resultOrder : {ResultOrder::Submission, ResultOrder::Completion}) {
+            std::vector<BatchResult> results;
+            size_t nextJob = 0;
+            SolveBatch([&](BatchJob* job) {
+                if (nextJob == jobs.size()) {
+                    return false;
+                }
+                *job = jobs[nextJob++];
+                return true;
+            }, [&](const BatchResult& result) {
+                results.push_back(result);
+            }, resultOrder, 4);
+            if (results.size() != jobs.size()) {
+                throw std::runtime_error("Every job should give a result.");
+            }
+            auto byIndex = [](const BatchResult& lhs, const BatchResult& rhs) {
+                return lhs.index < rhs.index;
+            };
+            if (resultOrder == ResultOrder::Submission && !std::is_sorted(results.begin(), results.end(), byIndex)) {
+                throw std::runtime_error("Results should come in submission order.");
+            }
+            std::sort(results.begin(), results.end(), byIndex);
+            for (size_t index = 0; index + 1 < jobs.size(); ++index) {
+                if (!results[index].error.empty() || results[index].basis != SolveBatchJob(index, jobs[index]).basis) {
+                    throw std::runtime_error("Batch result should match the sequential one.");
+                }
+            }
+            if (results.back().error.empty()) {
+                throw std::runtime_error("Unknown order should be reported.");
+            }
+        }
+
+        std::atomic<size_t> readCount = 0;
+        std::atomic<size_t> deliveredCount = 0;
+        size_t maxReadAhead = 0;
+        SolveBatch([&](BatchJob* job) {
+            maxReadAhead = std::max(maxReadAhead, readCount - deliveredCount);
+            if (readCount == 200) {
+                return false;
+            }
+            *job = ParseBatchJob("lex rational: a^2 - b, b^2 - a");
+            ++readCount;
+            return true;
+        }, [&](const BatchResult&) {
+            ++deliveredCount;
+        }, ResultOrder::Submission, 2);
+        if (deliveredCount != 200 || maxReadAhead > 4 * 2) {
+            throw std::runtime_error("Batch should not read far ahead of the results.");
+        }
+
+        std::istringstream input("lex rational: a - b\nno colon here\n");
+        std::ostringstream output;
+        char program[] = "main";
+        char batch[] = "--batch";
+        char threads[] = "--threads";
+        char two[] = "2";
+        char notNumber[] = "many";
+        char* goodArgs[] = {program, batch, threads, two};
+        if (RunBatchDriver(4, goodArgs, input, output) != 1 || output.str().find("1: error: Job should look like") == std::string::npos) {
+            throw std::runtime_error("Parse errors should reach the output.");
+        }
+        char* badArgs[] = {program, batch, threads, notNumber};
+        char* missingArgs[] = {program, batch, threads};
+        if (RunBatchDriver(4, badArgs, input, output) != 1 || RunBatchDriver(3, missingArgs, input, output) != 1) {
+            throw std::runtime_error("Invalid thread count should be rejected.");
+        }
+    }
+
+    void test_basis() {
+        using Poly = Polynomial<Rational, LexOrder>;
+        Poly a(Monomial({1}));
+        Poly b(Monomial({0, 1}));
+        Poly two(Rational(2));
+
+        Basis<Rational, LexOrder> basis;
+        auto first = basis.insert(two * a + b);
+        auto second = basis.insert(b * b);
+        auto zero = basis.insert(Poly());
+        if (basis.size() != 2 || basis.contains(zero) || basis.getLeadingMonomial(first) != Monomial({1})) {
+            throw std::runtime_error("Zero polynomials should not be stored.");
+        }
+        if (basis.find(b * b) != second || basis.find(b) != basis.NoId) {
+            throw std::runtime_error("Elements should be found by value.");
+        }
+        if (basis.begin().id() != second) {
+            throw std::runtime_error("Iteration should go in increasing order of leading monomials.");
+        }
+
+        basis.modify(first, [&](Poly* p) {
+            *p -= two * a;
+        });
+        if (basis[first] != b || basis.getLeadingMonomial(first) != Monomial({0, 1}) || basis.begin().id() != first) {
+            throw std::runtime_error("Modified element should keep its id and be reindexed.");
+        }
+        auto extracted = basis.extract(second);
+        if (basis.size() != 1 || basis.contains(second)) {
+            throw std::runtime_error("Extracted element should leave the basis.");
+        }
+        basis.replace(second, two * extracted);
+        basis.normalize();
+        if (basis.getLeadingCoefficient(second) != Rational(1) || basis.getIds() != std::vector<size_t>({first, second})) {
+            throw std::runtime_error("Replaced element should take the same id.");
+        }
+
+        auto family = GenerateCyclicFamily<DegreeRevLexOrder>(4);
+        auto familyDRL = family;
+        DoBuhberger(&familyDRL);
+        Basis<Rational, DegreeRevLexOrder> familyBasis(family);
+        DoBuhberger(&familyBasis);
+        if (!AreEqualBases(familyDRL, std::move(familyBasis).toSet())) {
+            throw std::runtime_error("Basis and set should give the same reduced basis.");
+        }
+    }
+
+    void test_multiplication() {
+        auto powerFamily = GeneratePowerFamily<DegreeRevLexOrder>(8);
+        auto symmetricFamily = GenerateSymmetricFamily<DegreeRevLexOrder>(powerFamily);
+        RationalPolynomialDegRevLex zero;
+        for (size_t threadsCount : {1, 2, 4}) {
+            ThreadPool pool(threadsCount);
+            for (size_t k = 1; k < symmetricFamily.size(); ++k) {
+                const auto& lhs = symmetricFamily[k];
+                const auto& rhs = symmetricFamily[symmetricFamily.size() - k] + powerFamily[k];
+                if (ParallelMultiply(lhs, rhs, &pool) != lhs * rhs || ParallelMultiply(rhs, lhs, &pool) != lhs * rhs) {
+                    throw std::runtime_error("Parallel product should match the serial one.");
+                }
+            }
+            if (ParallelMultiply(symmetricFamily[4], zero, &pool) != zero
+                || ParallelMultiply(symmetricFamily[4], symmetricFamily[0], &pool) != symmetricFamily[4]) {
+                throw std::runtime_error("Parallel product with constants does not work as intended");
+            }
+        }
+        ThreadPool workers(4);
+        auto copyAnchor = RationalPolynomialDegRevLex::countCopyCTors();
+        auto copyAssignAnchor = RationalPolynomialDegRevLex::countCopyAsgnmts();
+        auto moveAssignAnchor = RationalPolynomialDegRevLex::countMoveAsgnmts();
+        auto product = ParallelMultiply(symmetricFamily[5], symmetricFamily[3], &workers);
+        // The counters include the workers, which sum the partial products and clear the summed ones.
+        if (RationalPolynomialDegRevLex::countMoveAsgnmts() == moveAssignAnchor) {
+            throw std::runtime_error("Operations on the workers should be counted.");
+        }
+        if (RationalPolynomialDegRevLex::countCopyCTors() != copyAnchor || RationalPolynomialDegRevLex::countCopyAsgnmts() != copyAssignAnchor) {
+            throw std::runtime_error("Parallel product should not copy polynomials.");
+        }
+        std::unique_ptr<ThreadPool> pool;
+        if (Multiply(symmetricFamily[4], symmetricFamily[4], &pool) != symmetricFamily[4] * symmetricFamily[4]) {
+            throw std::runtime_error("Product above the threshold should match the serial one.");
+        }
+    }
+
+    void test_trace() {
+        auto symmetricFamily = GenerateSymmetricFamily<DegreeRevLexOrder>(GeneratePowerFamily<DegreeRevLexOrder>(4));
+        auto makeInstance = [&](const std::vector<Rational>& constants) {
+            RationalPolynomialVector<DegreeRevLexOrder> generators;
+            for (size_t k = 1; k < symmetricFamily.size(); ++k) {
+                generators.push_back(symmetricFamily[k] * constants[k - 1] + constants[k - 1] * constants[k - 1]);
+            }
+            return generators;
+        };
+        auto solve = [](const RationalPolynomialVector<DegreeRevLexOrder>& generators) {
+            RationalPolynomialSet<DegreeRevLexOrder> basis(generators.begin(), generators.end());
+            DoBuhberger(&basis);
+            return basis;
+        };
+
+        ReductionTrace trace;
+        auto recorded = makeInstance({1, 2, 3, 5});
+        if (!AreEqualBases(RecordTrace(recorded, &trace), solve(recorded))) {
+            throw std::runtime_error("Recorded run should give the reduced basis.");
+        }
+        for (const auto& constants : std::vector<std::vector<Rational>>{{2, 3, 7, 11}, {Rational(1, 2), -4, 13, Rational(5, 3)}}) {
+            auto instance = makeInstance(constants);
+            bool isReplayed = false;
+            if (!AreEqualBases(SolveWithTrace(trace, instance, &isReplayed), solve(instance)) || !isReplayed) {
+                throw std::runtime_error("Replayed run should give the reduced basis.");
+            }
+        }
+
+        auto special = makeInstance({1, 1, 1, 1});
+        special.push_back(symmetricFamily[1]);
+        bool isReplayed = true;
+        if (!AreEqualBases(SolveWithTrace(trace, special, &isReplayed), solve(special)) || isReplayed) {
+            throw std::runtime_error("Instance with another structure should fall back to the full computation.");
+        }
+
+        RationalPolynomialDegRevLex zero;
+        recorded.push_back(zero);
+        ReductionTrace traceWithZero;
+        if (!AreEqualBases(RecordTrace(recorded, &traceWithZero), solve(recorded))) {
+            throw std::runtime_error("Zero generators should be skipped.");
+        }
+        auto instance = makeInstance({2, 3, 7, 11});
+        instance.push_back(zero);
+        if (!AreEqualBases(SolveWithTrace(traceWithZero, instance, &isReplayed), solve(instance)) || !isReplayed) {
+            throw std::runtime_error("Replayed run should give the reduced basis.");
+        }
+
+        RationalPolynomialDegRevLex x(Monomial({1}));
+        RationalPolynomialDegRevLex y(Monomial({0, 1}));
+        ReductionTrace pivotTrace;
+        RecordTrace(RationalPolynomialVector<DegreeRevLexOrder>{x * x + Rational(2) * x * y, x * y + y * y}, &pivotTrace);
+        // The S-polynomial is (a - 1)xy^2, so its pivot vanishes for a = 1.
+        RationalPolynomialVector<DegreeRevLexOrder> vanishing{x * x + x * y, x * y + y * y};
+        if (!AreEqualBases(SolveWithTrace(pivotTrace, vanishing, &isReplayed), solve(vanishing)) || isReplayed) {
+            throw std::runtime_error("Instance with a vanishing pivot should fall back to the full computation.");
+        }
+    }
+
+    void test_walk() {
+        using Poly = Polynomial<Rational, DegreeRevLexOrder>;
+        Poly a(Monomial({1}));
+        Poly b(Monomial({0, 1}));
+        Poly c(Monomial({0, 0, 1}));
+        Poly d(Monomial({0, 0, 0, 1}));
+        Poly one(Rational(1));
+        std::vector<RationalPolynomialSet<DegreeRevLexOrder>> ideals = {
+            {a * a - b * c, b * b - a * c},
+            {b - a * a, c - a * a * a},
+            {a * b * c - d, a * a - b * d, c * c * d - a + b},
+            GenerateCyclicFamily<DegreeRevLexOrder>(4),
+        };
+        for (const auto& ideal : ideals) {
+            auto lexBasis = ChangeOrder<LexOrder>(ideal);
+            DoBuhberger(&lexBasis);
+            if (!AreEqualBases(DoGroebnerWalk<LexOrder>(ideal), lexBasis)) {
+                throw std::runtime_error("Walk to Lex should give the reduced Lex basis.");
+            }
+            auto blockBasis = ChangeOrder<BlockOrder<2>>(ideal);
+            DoBuhberger(&blockBasis);
+            if (!AreEqualBases(DoGroebnerWalk<BlockOrder<2>>(ideal), blockBasis)) {
+                throw std::runtime_error("Walk to a block order should give the reduced basis in it.");
+            }
+        }
+    }
+
+    void test_quotient_ring() {
+        using Poly = Polynomial<Rational, DegreeRevLexOrder>;
+        auto basis = GenerateCyclicFamily<DegreeRevLexOrder>(3);
+        DoBuhberger(&basis);
+        QuotientRing<Rational, DegreeRevLexOrder> ring(basis);
+        if (ring.getDimension() != 6 || ring.getStaircase().front() != Monomial()) {
+            throw std::runtime_error("Staircase of the ideal should have 3! monomials.");
+        }
+
+        Poly a(Monomial({1}));
+        Poly b(Monomial({0, 1}));
+        Poly one(Rational(1));
+        auto normalForm = [&](Poly p) {
+            ReduceOverSetWhilePossible(basis, &p);
+            return p;
+        };
+        Poly f = a * a + Rational(2) * b - one;
+        Poly g = a * b + Rational(3);
+        auto fElement = ring.toElement(f);
+        auto gElement = ring.toElement(g);
+        if (ring.toPolynomial(ring.multiply(fElement, gElement)) != normalForm(f * g)
+            || ring.toPolynomial(ring.multiply(gElement, fElement)) != normalForm(f * g)
+            || ring.multiply(fElement, ring.toElement(Poly())) != ring.toElement(Poly())) {
+            throw std::runtime_error("Product in the quotient ring should match the normal form.");
+        }
+        if (ring.toPolynomial(ring.power(fElement, 5)) != normalForm(f * f * f * f * f)) {
+            throw std::runtime_error("Power in the quotient ring should match the normal form.");
+        }
+        if (ring.multiply(ring.inverse(gElement), gElement) != ring.one()) {
+            throw std::runtime_error("Inverse should give one in product.");
+        }
+        // a is a root of t^3 - e1 t^2 + e2 t - e3 = t^3 - 1.
+        if (ring.minimalPolynomial(ring.toElement(a), 0) != a * a * a - one) {
+            throw std::runtime_error("Minimal polynomial does not work as intended");
+        }
+        auto minimal = ring.minimalPolynomial(gElement, 0);
+        auto value = ring.toElement(Poly());
+        for (const auto& term : minimal) {
+            auto power = ring.power(gElement, Poly::getMonomial(term).totalDegree());
+            for (auto& coordinate : power) {
+                coordinate *= Poly::getCoefficient(term);
+            }
+            value = ring.add(value, power);
+        }
+        if (value != ring.toElement(Poly())) {
+            throw std::runtime_error("Element should be a root of its minimal polynomial.");
+        }
+
+        bool isThrown = false;
+        try {
+            QuotientRing<Rational, DegreeRevLexOrder>(RationalPolynomialSet<DegreeRevLexOrder>({a * b}));
+        } catch (const std::runtime_error&) {
+            isThrown = true;
+        }
+        if (!isThrown) {
+            throw std::runtime_error("Positive-dimensional ideal should be rejected.");
+        }
+        isThrown = false;
+        try {
+            ring.multiplyByVariable(fElement, 3);
+        } catch (const std::runtime_error&) {
+            isThrown = true;
+        }
+        if (!isThrown) {
+            throw std::runtime_error("Variable outside the ring should be rejected.");
+        }
+    }
+
+    void test_univariate() {
+        using Univariate = UnivariatePolynomial<Rational>;
+        auto x = Univariate::getPower(1);
+        Univariate one(Rational(1));
+
+        std::vector<Rational> lhsCoefficients;
+        std::vector<Rational> rhsCoefficients;
+        for (size_t power = 0; power < 150; ++power) {
+            lhsCoefficients.emplace_back(static_cast<long long>(mt() % 7) - 3);
+            rhsCoefficients.emplace_back(static_cast<long long>(mt() % 7) - 3);
+        }
+        rhsCoefficients.resize(90);
+        Univariate lhs(lhsCoefficients);
+        Univariate rhs(rhsCoefficients);
+        std::vector<Rational> expected(lhsCoefficients.size() + rhsCoefficients.size() - 1, Rational(0));
+        for (size_t left = 0; left < lhsCoefficients.size(); ++left) {
+            for (size_t right = 0; right < rhsCoefficients.size(); ++right) {
+                expected[left + right] += lhsCoefficients[left] * rhsCoefficients[right];
+            }
+        }
+        if (lhs * rhs != Univariate(expected)) {
+            throw std::runtime_error("Karatsuba product should match the schoolbook one.");
+        }
+        Univariate quotient;
+        Univariate remainder;
+        Divide(lhs * rhs + x, rhs, &quotient, &remainder);
+        if (quotient * rhs + remainder != lhs * rhs + x || remainder.degree() >= rhs.degree()) {
+            throw std::runtime_error("Division with remainder does not work as intended");
+        }
+
+        // Remainders of x^a - 1 and x^b - 1 stay integral, so the coefficients do not grow on rationals.
+        if (Gcd(Univariate::getPower(200) - one, Univariate::getPower(120) - one) != Univariate::getPower(40) - one) {
+            throw std::runtime_error("Gcd of x^200 - 1 and x^120 - 1 should be x^40 - 1.");
+        }
+        auto common = Univariate::getPower(60) - one;
+        if (Gcd(common * (x + Rational(2)), common * (x - Rational(3)) * Rational(5)) != common) {
+            throw std::runtime_error("Gcd should be monic common factor.");
+        }
+        if (Gcd(x * x + one, x) != one || !Gcd(Univariate(), Univariate()).isZero()) {
+            throw std::runtime_error("Gcd does not work as intended");
+        }
+
+        // Degrees above HalfGcdThreshold take the half-gcd, residues keep the coefficients small.
+        using ModularUnivariate = UnivariatePolynomial<Modular>;
+        auto randomModular = [](size_t degree) {
+            std::vector<Modular> coefficients;
+            for (size_t power = 0; power < degree; ++power) {
+                coefficients.emplace_back(static_cast<long long>(mt()));
+            }
+            coefficients.emplace_back(1);
+            return ModularUnivariate(std::move(coefficients));
+        };
+        auto euclidGcd = [](ModularUnivariate a, ModularUnivariate b) {
+            while (!b.isZero()) {
+                auto remainder = a % b;
+                a = std::move(b);
+                b = std::move(remainder);
+            }
+            return a.monic();
+        };
+        ModularUnivariate modularOne(Modular(1));
+        if (Gcd(ModularUnivariate::getPower(1000) - modularOne, ModularUnivariate::getPower(600) - modularOne)
+            != ModularUnivariate::getPower(200) - modularOne) {
+            throw std::runtime_error("Gcd of x^1000 - 1 and x^600 - 1 should be x^200 - 1.");
+        }
+        for (size_t attempt = 0; attempt < 3; ++attempt) {
+            auto modularCommon = randomModular(150);
+            auto a = modularCommon * randomModular(500 + 50 * attempt);
+            auto b = modularCommon * randomModular(450);
+            auto gcd = Gcd(a, b);
+            if (gcd != euclidGcd(a, b) || !(gcd % modularCommon).isZero()) {
+                throw std::runtime_error("Half-gcd should match the Euclidean algorithm.");
+            }
+        }
+
+        auto f = (x - one) * (x - one) * (x - one) * (x + Rational(2)) * (x + Rational(2)) * (x * x + one) * Rational(3);
+        auto factors = SquareFreeDecomposition(f);
+        if (factors != std::vector<Univariate>({x * x + one, x + Rational(2), x - one})) {
+            throw std::runtime_error("Square-free decomposition does not work as intended");
+        }
+        if (f.evaluate(Rational(1)) != Rational(0) || f.derivative().evaluate(Rational(0)) != Rational(24)) {
+            throw std::runtime_error("Evaluation does not work as intended");
+        }
+    }
+
+    void test_triangular() {
+        using Poly = Polynomial<Rational, LexOrder>;
+        Poly x(Monomial({1}));
+        Poly y(Monomial({0, 1}));
+        Poly one(Rational(1));
+
+        // y = 1 twice and y = -1 once, with x = y^2.
+        RationalPolynomialSet<LexOrder> shape({x - y * y, (y - one) * (y - one) * (y + one)});
+        DoBuhberger(&shape);
+        if (!IsInShapePosition(shape)) {
+            throw std::runtime_error("Basis should be in shape position.");
+        }
+        auto sets = SolveLexBasis(shape);
+        if (sets.size() != 2 || sets[0].multiplicity != 1 || sets[1].multiplicity != 2
+            || sets[0].polynomials != std::vector<Poly>({x - one, y + one})
+            || sets[1].polynomials != std::vector<Poly>({x - one, y - one})) {
+            throw std::runtime_error("Solutions of the shape basis do not match.");
+        }
+
+        RationalPolynomialSet<LexOrder> triangular({x * x - y, y * y * y * y - Rational(2) * y * y + one});
+        DoBuhberger(&triangular);
+        if (IsInShapePosition(triangular) || !IsTriangular(triangular)) {
+            throw std::runtime_error("Basis should be triangular but not in shape position.");
+        }
+        sets = SolveLexBasis(triangular);
+        if (sets.size() != 1 || sets[0].multiplicity != 2 || sets[0].polynomials != std::vector<Poly>({x * x - y, y * y - one})) {
+            throw std::runtime_error("Solutions of the triangular basis do not match.");
+        }
+
+        auto family = GenerateCyclicFamily<LexOrder>(3);
+        DoBuhberger(&family);
+        auto familySets = SolveLexBasis(family);
+        for (const auto& set : familySets) {
+            for (const auto& p : set.polynomials) {
+                if (!LaysInRadical(family, p)) {
+                    throw std::runtime_error("Triangular sets should vanish on the solutions.");
+                }
+            }
+        }
+
+        bool isThrown = false;
+        try {
+            SolveLexBasis(RationalPolynomialSet<LexOrder>({x * x, x * y, y * y}));
+        } catch (const std::runtime_error&) {
+            isThrown = true;
+        }
+        if (!isThrown || !SolveLexBasis(RationalPolynomialSet<LexOrder>({one})).empty()) {
+            throw std::runtime_error("Non-triangular bases should be rejected.");
+        }
+    }
+
+    void test_preprocessing() {
+        using Poly = Polynomial<Rational, LexOrder>;
+        Poly a(Monomial({1}));
+        Poly b(Monomial({0, 1}));
+        Poly c(Monomial({0, 0, 1}));
+        Poly d(Monomial({0, 0, 0, 1}));
+        Poly one(Rational(1));
+        static_assert(IsRenumberingInvariant<DegreeRevLexOrder>::value && !IsRenumberingInvariant<BlockOrder<2>>::value);
+
+        if (SubstituteVariable(b * b * c + a, 1, a + one) != (a * a + Rational(2) * a + one) * c + a) {
+            throw std::runtime_error("Substitution does not work as intended");
+        }
+
+        PolynomialSet<Rational, LexOrder> ideal({a * a + b * b + c * c - one, a * a + c * c - b, a - c});
+        auto expected = ideal;
+        DoBuhberger(&expected);
+        DoBuhbergerWithPreprocessing(&ideal);
+        if (!AreEqualBases(ideal, expected)) {
+            throw std::runtime_error("Preprocessing should not change the Lex basis.");
+        }
+
+        // Binomials solved for b and a, with a solved in terms of an eliminated variable.
+        PolynomialSet<Rational, LexOrder> binomials({b - d * d, a - b * c, c * c * c - d * c + one, d * d * d - c});
+        expected = binomials;
+        DoBuhberger(&expected);
+        DoBuhbergerWithPreprocessing(&binomials);
+        if (!AreEqualBases(binomials, expected)) {
+            throw std::runtime_error("Preprocessing should not change the basis with binomials.");
+        }
+
+        for (size_t n = 3; n <= 5; ++n) {
+            auto family = GenerateCyclicFamily<DegreeRevLexOrder>(n);
+            auto familyExpected = family;
+            DoBuhberger(&familyExpected);
+            DoBuhbergerWithPreprocessing(&family);
+            if (!AreEqualBases(family, familyExpected)) {
+                throw std::runtime_error("Preprocessing should not change the basis of the family.");
+            }
+        }
+
+        using PolyBlock = Polynomial<Rational, BlockOrder<2>>;
+        PolyBlock x(Monomial({1}));
+        PolyBlock y(Monomial({0, 1}));
+        PolyBlock z(Monomial({0, 0, 1}));
+        PolyBlock t(Monomial({0, 0, 0, 1}));
+        PolynomialSet<Rational, BlockOrder<2>> blockIdeal({x - y * z, y * y - t, z + t * t - PolyBlock(Rational(1)), t * t * t - z});
+        auto blockExpected = blockIdeal;
+        DoBuhberger(&blockExpected);
+        DoBuhbergerWithPreprocessing(&blockIdeal);
+        if (!AreEqualBases(blockIdeal, blockExpected)) {
+            throw std::runtime_error("Preprocessing should keep the indices for block orders.");
+        }
+
+        PolynomialSet<Rational, LexOrder> inconsistent({a - b, c - a, b - c + one, d * d - a});
+        DoBuhbergerWithPreprocessing(&inconsistent);
+        if (inconsistent != PolynomialSet<Rational, LexOrder>({one})) {
+            throw std::runtime_error("Inconsistent linear part should give the unit ideal.");
+        }
+    }
+
+    void test_modular() {
+        {
+            ModulusScope scope(7);
+            if (Modular(3) / Modular(5) * Modular(5) != Modular(3) || -Modular(3) != Modular(4) || Modular(-1) != Modular(6)) {
+                throw std::runtime_error("Modular arithmetic does not work as intended");
+            }
+            bool isThrown = false;
+            try {
+                Modular(14).inverse();
+            } catch (const std::runtime_error&) {
+                isThrown = true;
+            }
+            if (!isThrown || Modular::getModulus() != 7) {
+                throw std::runtime_error("Zero residue should not be invertible.");
+            }
+        }
+        if (Modular::getModulus() == 7 || !IsPrime(2147483647u) || IsPrime(561) || IsPrime(2147483649u)) {
+            throw std::runtime_error("Modulus scope or primality test does not work as intended");
+        }
+        uint32_t prime = GetRandomPrime();
+        if (prime < (1u << 30) || prime >= (1u << 31) || !IsPrime(prime)) {
+            throw std::runtime_error("Random prime should be a 31-bit prime.");
+        }
+
+        auto family = GenerateCyclicFamily<DegreeRevLexOrder>(4);
+        auto rationalBasis = family;
+        DoBuhberger(&rationalBasis);
+        {
+            ModulusScope scope(prime);
+            PolynomialSet<Modular, DegreeRevLexOrder> modularBasis;
+            if (!ToModular(family, &modularBasis)) {
+                throw std::runtime_error("Integer coefficients should have residues.");
+            }
+            DoBuhberger(&modularBasis);
+            PolynomialSet<Modular, DegreeRevLexOrder> expected;
+            ToModular(rationalBasis, &expected);
+            if (modularBasis != expected) {
+                throw std::runtime_error("Basis modulo a prime should be the residue of the rational one.");
+            }
+        }
+
+        using Poly = Polynomial<Rational, LexOrder>;
+        Poly a(Monomial({1}));
+        Poly b(Monomial({0, 1}));
+        Poly c(Monomial({0, 0, 1}));
+        Poly one(Rational(1));
+        PolynomialSet<Rational, LexOrder> ideal({a * a + b * b + c * c - one, a * a + c * c - b, a - c});
+        for (const auto& p : {a - c, b * b + b - one, Rational(1, 2) * (a * a + c * c - b) * c, a - b, a * b * c, one}) {
+            if (FastLaysInIdeal(ideal, p) != LaysInIdeal(ideal, p)) {
+                throw std::runtime_error("Fast membership test should agree with the exact one.");
+            }
+        }
+        PolynomialSet<Rational, LexOrder> power({a * a * a, b * b - Rational(2, 3) * c});
+        if (!FastLaysInRadical(power, a) || FastLaysInRadical(power, b) || !FastLaysInRadical(power, b * b * b * b - Rational(4, 9) * c * c)) {
+            throw std::runtime_error("Fast radical membership test does not work as intended");
+        }
+        if (!FastIsUnitIdeal(PolynomialSet<Rational, LexOrder>({a - one, a - Rational(1, 3)})) || FastIsUnitIdeal(ideal)) {
+            throw std::runtime_error("Fast unit ideal test does not work as intended");
+        }
+    }
+
+    void test_out_of_core() {
+        using Poly = Polynomial<Rational, DegreeRevLexOrder>;
+        Poly x(Monomial({1}));
+        Poly y(Monomial({0, 1}));
+        Poly z(Monomial({0, 0, 1}));
+        Poly p = Rational(-3, 7) * x * x * y + Rational(1000000007) * z - Rational(1, 2);
+        std::vector<char> bytes;
+        PackPolynomial(p, &bytes);
+        if (UnpackPolynomial<Rational, DegreeRevLexOrder>(bytes.data()) != p) {
+            throw std::runtime_error("Packed polynomial should be unpacked unchanged.");
+        }
+
+        SpillFile file;
+        std::vector<SpillRecord> records;
+        for (size_t index = 0; index < 3000; ++index) {
+            bytes.clear();
+            PackPolynomial(p * Poly(Monomial({index, 0, index % 7})), &bytes);
+            records.push_back(file.append(bytes));
+        }
+        if (UnpackPolynomial<Rational, DegreeRevLexOrder>(file.getData(records[17])) != p * Poly(Monomial({17, 0, 3}))) {
+            throw std::runtime_error("Records should survive the growth of the spill file.");
+        }
+
+        SpilledQueue<QueuedPair> queue(&file, 0, 16);
+        for (size_t index = 0; index < 100; ++index) {
+            queue.push({index, 2 * index});
+        }
+        if (queue.getSpilledChunksCount() == 0) {
+            throw std::runtime_error("Queue over its limit should spill.");
+        }
+        for (size_t index = 0; index < 100; ++index) {
+            auto pair = queue.pop();
+            if (pair.first != index || pair.second != 2 * index) {
+                throw std::runtime_error("Spilled queue should keep the order of values.");
+            }
+        }
+
+        SpilledBasis<Rational, DegreeRevLexOrder> basis(&file, 0);
+        auto first = basis.insert(p);
+        auto second = basis.insert(x * y - z);
+        if (basis.getResidentBytes() != EstimateMemoryUsage(x * y - z) || *basis.get(first) != p
+            || basis.getPagedInCount() != 1 || basis.findReducer(Monomial({1, 1, 1})) != second) {
+            throw std::runtime_error("Spilled basis should keep one element and page in the others.");
+        }
+
+        BuhbergerOptions options;
+        options.spillThreshold = 0;
+        for (size_t n = 3; n <= 5; ++n) {
+            auto family = GenerateCyclicFamily<DegreeRevLexOrder>(n);
+            auto expected = family;
+            DoBuhberger(&expected);
+            if (DoOutOfCoreBuhberger(&family, options) != BuhbergerStatus::Completed || !AreEqualBases(family, expected)) {
+                throw std::runtime_error("Out-of-core basis should match the in-memory one.");
+            }
+        }
+        PolynomialSet<Rational, DegreeRevLexOrder> ideal({x * x * y - z * z, x * z - y * y * y + x, y * z * z - x * x});
+        auto expected = ideal;
+        DoBuhberger(&expected);
+        DoOutOfCoreBuhberger(&ideal, options);
+        if (!AreEqualBases(ideal, expected)) {
+            throw std::runtime_error("Out-of-core basis should match the in-memory one.");
+        }
+    }
+
+    void test_portfolio() {
+        using Set = PolynomialSet<Rational, LexOrder>;
+        auto family = GenerateCyclicFamily<LexOrder>(4);
+        auto expected = family;
+        DoBuhberger(&expected);
+        auto strategies = GetDefaultPortfolio<Rational, LexOrder>();
+        if (strategies.size() != 4) {
+            throw std::runtime_error("Default portfolio for lex should include the walk.");
+        }
+        auto result = RunPortfolio(family, strategies);
+        if (result.winner == result.NoWinner || !AreEqualBases(result.basis, expected)) {
+            throw std::runtime_error("Portfolio basis should match the direct one.");
+        }
+
+        PortfolioStrategy<Rational, LexOrder> slow{"slow", [](const Set&, const BuhbergerOptions& options, Set*) {
+            while (!options.cancellationToken->isCancelled()) {
+                std::this_thread::yield();
+            }
+            return BuhbergerStatus::Cancelled;
+        }};
+        result = RunPortfolio(family, {slow, strategies[0]});
+        if (result.winner != 1 || result.statuses[0] != BuhbergerStatus::Cancelled || !AreEqualBases(result.basis, expected)) {
+            throw std::runtime_error("Losing strategies should be cancelled.");
+        }
+
+        CancellationToken token;
+        token.cancel();
+        BuhbergerOptions options;
+        options.cancellationToken = &token;
+        result = RunPortfolio(family, {slow}, options);
+        if (result.winner != result.NoWinner || result.statuses[0] != BuhbergerStatus::Cancelled) {
+            throw std::runtime_error("Cancellation by the caller should reach the strategies.");
+        }
+
+        PortfolioStrategy<Rational, LexOrder> failing{"failing", [](const Set&, const BuhbergerOptions&, Set*) -> BuhbergerStatus {
+            throw std::runtime_error("Failed.");
+        }};
+        bool isThrown = false;
+        try {
+            RunPortfolio(family, {failing}, options);
+        } catch (const std::runtime_error&) {
+            isThrown = true;
+        }
+        result = RunPortfolio(family, {failing, strategies[0]});
+        if (!isThrown || result.winner != 1 || result.errors[0] != "Failed.") {
+            throw std::runtime_error("Errors of strategies do not work as intended");
+        }
+        PortfolioStrategy<Rational, LexOrder> throwingNonException{"throwing", [](const Set&, const BuhbergerOptions&, Set*) -> BuhbergerStatus {
+            throw 1;
+        }};
+        isThrown = false;
+        try {
+            RunPortfolio(family, {throwingNonException});
+        } catch (int) {
+            isThrown = true;
+        }
+        if (!isThrown) {
+            throw std::runtime_error("Exceptions of any type should be passed to the caller.");
+        }
+        // Every default strategy should notice a cancelled token.
+        for (const auto& strategy : strategies) {
+            Set basis;
+            if (strategy.solve(family, options, &basis) != BuhbergerStatus::Cancelled) {
+                throw std::runtime_error("Default strategies should poll the token.");
+            }
+        }
+
+        std::atomic<size_t> callbacksInside = 0;
+        bool isOverlapped = false;
+        size_t reportsCount = 0;
+        BuhbergerOptions reporting;
+        reporting.progressCallback = [&](const BuhbergerProgress&) {
+            isOverlapped = isOverlapped || callbacksInside++ != 0;
+            ++reportsCount;
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            --callbacksInside;
+        };
+        result = RunPortfolio(family, {strategies[0], strategies[0], strategies[0]}, reporting);
+        if (result.winner == result.NoWinner || reportsCount == 0 || isOverlapped) {
+            throw std::runtime_error("Progress callback should be called one at a time.");
+        }
+    }
+
     void test_all() {
         test_monomials();
         test_monomial_order();
         test_polynomials();
         test_algorithm();
         test_algorithm_cyclic();
+        test_truncated();
+        test_elimination();
+        test_symmetry();
+        test_control();
+        test_batch();
+        test_basis();
+        test_multiplication();
+        test_trace();
+        test_walk();
+        test_quotient_ring();
+        test_univariate();
+        test_triangular();
+        test_preprocessing();
+        test_modular();
+        test_out_of_core();
+        test_portfolio();
     }
 
     Monomial random_monomial() {
@@ -6,8 +6,22 @@
 #include "monomial.h"
 #include "monomial_order.h"
 #include "polynomial.h"
+#include "truncated.h"
 #include "cyclic.h"
+#include "elimination.h"
+#include "symmetry.h"
+#include "batch.h"
+#include "trace.h"
+#include "walk.h"
+#include "quotient_ring.h"
+#include "triangular.h"
+#include "preprocessing.h"
+#include "modular_checks.h"
+#include "out_of_core.h"
+#include "portfolio.h"
+#include "parser.h"
 #include "boost/rational.hpp"
+#include <atomic>
 #include <random>
 
 namespace Groebner {
@@ -18,6 +32,22 @@ namespace Groebner {
     void test_algorithm_lex();
     void test_algorithm_grlex();
     void test_algorithm_cyclic();
+    void test_truncated();
+    void test_elimination();
+    void test_symmetry();
+    void test_control();
+    void test_batch();
+    void test_basis();
+    void test_multiplication();
+    void test_trace();
+    void test_walk();
+    void test_quotient_ring();
+    void test_univariate();
+    void test_triangular();
+    void test_preprocessing();
+    void test_modular();
+    void test_out_of_core();
+    void test_portfolio();
     void test_all();
 
     Monomial random_monomial();
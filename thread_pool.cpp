@@ -0,0 +1,102 @@
+#include "thread_pool.h"
+#include <algorithm>
+
+namespace Groebner {
+    namespace {
+        thread_local const ThreadPool* currentPool = nullptr;
+        thread_local size_t currentWorkerIndex = 0;
+    }
+
+    ThreadPool::ThreadPool(size_t threadsCount) {
+        threadsCount = std::max<size_t>(threadsCount, 1);
+        for (size_t workerIndex = 0; workerIndex < threadsCount; ++workerIndex) {
+            queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (size_t workerIndex = 0; workerIndex < threadsCount; ++workerIndex) {
+            workers.emplace_back(&ThreadPool::workerLoop, this, workerIndex);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        wait();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        hasTasks.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::submit(std::function<void()> task) {
+        size_t queueIndex;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queueIndex = (currentPool == this ? currentWorkerIndex : nextQueue++ % queues.size());
+        }
+        {
+            std::lock_guard<std::mutex> lock(queues[queueIndex]->mutex);
+            queues[queueIndex]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++queuedTasks;
+            ++unfinishedTasks;
+        }
+        hasTasks.notify_one();
+    }
+
+    void ThreadPool::wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        isIdle.wait(lock, [this] { return unfinishedTasks == 0; });
+    }
+
+    size_t ThreadPool::size() const {
+        return workers.size();
+    }
+
+    bool ThreadPool::tryPop(size_t workerIndex, std::function<void()>* task) {
+        for (size_t shift = 0; shift < queues.size(); ++shift) {
+            auto& queue = *queues[(workerIndex + shift) % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            if (shift == 0) {
+                *task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            } else {
+                *task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void ThreadPool::workerLoop(size_t workerIndex) {
+        currentPool = this;
+        currentWorkerIndex = workerIndex;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                hasTasks.wait(lock, [this] { return stopping || queuedTasks > 0; });
+                if (queuedTasks == 0) {
+                    return;
+                }
+                --queuedTasks;
+            }
+            // A task is reserved for this worker, so some deque is guaranteed to hold one.
+            std::function<void()> task;
+            while (!tryPop(workerIndex, &task)) {
+                std::this_thread::yield();
+            }
+            task();
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--unfinishedTasks == 0) {
+                isIdle.notify_all();
+            }
+        }
+    }
+}
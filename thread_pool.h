@@ -0,0 +1,49 @@
+#ifndef GROEBNER_THREAD_POOL_H
+#define GROEBNER_THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Groebner {
+    // Fixed set of workers, each with its own task deque. A worker takes its newest task first
+    // and, when its deque is empty, steals the oldest task of another worker.
+    class ThreadPool {
+     public:
+        explicit ThreadPool(size_t threadsCount = std::thread::hardware_concurrency());
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        // Finishes all submitted tasks before joining the workers.
+        ~ThreadPool();
+
+        // Tasks submitted from a worker go to its own deque, others are spread round-robin.
+        void submit(std::function<void()> task);
+        // Blocks until every submitted task is finished.
+        void wait();
+        size_t size() const;
+     private:
+        struct WorkerQueue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues;
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable hasTasks;
+        std::condition_variable isIdle;
+        size_t queuedTasks = 0;
+        size_t unfinishedTasks = 0;
+        size_t nextQueue = 0;
+        bool stopping = false;
+
+        void workerLoop(size_t workerIndex);
+        bool tryPop(size_t workerIndex, std::function<void()>* task);
+    };
+}
+
+#endif //GROEBNER_THREAD_POOL_H
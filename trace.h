@@ -0,0 +1,218 @@
+#ifndef GROEBNER_TRACE_H
+#define GROEBNER_TRACE_H
+
+#include "algorithm.h"
+#include <deque>
+
+namespace Groebner {
+    // Subtraction of (coefficient * multiplier) times the reducer, the coefficient is taken
+    // from the term multiplier * LM(reducer) of the reduced polynomial.
+    struct TraceStep {
+        Monomial multiplier;
+        size_t reducer;
+    };
+
+    // A reduction that gave a non-zero result: of the S-polynomial of the pair (first, second),
+    // or of the tail of the element first during interreduction.
+    struct TraceOperation {
+        size_t first;
+        size_t second;
+        std::vector<TraceStep> steps;
+        // Monomials of the result in increasing order.
+        std::vector<Monomial> support;
+    };
+
+    // Useful steps of a Buchberger run on one instance of a family of systems with equal supports.
+    // Elements are referred to by their ids in Basis, generators taking the first ids.
+    struct ReductionTrace {
+        std::vector<std::vector<Monomial>> generatorSupports;
+        std::vector<TraceOperation> pairs;
+        std::vector<size_t> minimalIds;
+        std::vector<TraceOperation> interreductions;
+    };
+
+    template <typename FieldElement, typename OrderType>
+    std::vector<Monomial> GetSupport(const Polynomial<FieldElement, OrderType>& p) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        std::vector<Monomial> support;
+        for (const auto& term : p) {
+            support.push_back(Poly::getMonomial(term));
+        }
+        return support;
+    }
+
+    // Reduces the terms of g from the highest one down, recording every step.
+    template <typename FieldElement, typename OrderType>
+    void ReduceRecording(const Basis<FieldElement, OrderType>& basis, Polynomial<FieldElement, OrderType>* g,
+                         bool keepLeadingTerm, std::vector<TraceStep>* steps) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        const Poly& reduced = *g;
+        auto term = reduced.rbegin();
+        if (keepLeadingTerm && term != reduced.rend()) {
+            ++term;
+        }
+        while (term != reduced.rend()) {
+            const Monomial monomial = Poly::getMonomial(*term);
+            auto reducer = std::find_if(basis.begin(), basis.end(), [&](const Poly& element) {
+                return monomial.isDivisibleBy(Poly::getMonomial(element.leadingTerm()));
+            });
+            if (reducer == basis.end()) {
+                ++term;
+                continue;
+            }
+            Monomial multiplier = monomial / basis.getLeadingMonomial(reducer.id());
+            FieldElement coefficient = Poly::getCoefficient(*term) / basis.getLeadingCoefficient(reducer.id());
+            g->subtractMultiple(multiplier, coefficient, *reducer);
+            steps->push_back({std::move(multiplier), reducer.id()});
+            // Only the terms below the reduced one have changed.
+            term = std::make_reverse_iterator(reduced.lowerBound(monomial));
+        }
+    }
+
+    // Repeats the recorded steps on g, returns false if a pivot vanished or the result has another support.
+    template <typename FieldElement, typename OrderType>
+    bool ReplaySteps(const Basis<FieldElement, OrderType>& basis, const TraceOperation& operation,
+                     Polynomial<FieldElement, OrderType>* g) {
+        for (const auto& step : operation.steps) {
+            if (!basis.contains(step.reducer)) {
+                return false;
+            }
+            FieldElement coefficient = g->getCoefficientOf(step.multiplier * basis.getLeadingMonomial(step.reducer));
+            if (coefficient == FieldElement(0)) {
+                return false;
+            }
+            coefficient /= basis.getLeadingCoefficient(step.reducer);
+            g->subtractMultiple(step.multiplier, coefficient, basis[step.reducer]);
+        }
+        return g->size() == operation.support.size() && GetSupport(*g) == operation.support;
+    }
+
+    // Buchberger algorithm with full reductions and pairs taken in the order of creation,
+    // finished by minimalization and interreduction. The useful steps are stored in the trace.
+    template <typename FieldElement, typename OrderType>
+    PolynomialSet<FieldElement, OrderType> RecordTrace(const std::vector<Polynomial<FieldElement, OrderType>>& generators,
+                                                       ReductionTrace* trace) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        using Id = typename Basis<FieldElement, OrderType>::Id;
+        *trace = ReductionTrace();
+        Basis<FieldElement, OrderType> basis;
+        std::deque<std::pair<Id, Id>> pairs;
+        // A zero generator still takes its id, so that the ids of the others match the replayed ones.
+        auto insert = [&](Poly p) {
+            p.normalize();
+            if (p != FieldElement(0)) {
+                for (auto other : basis.getIds()) {
+                    pairs.emplace_back(other, basis.getIdsBound());
+                }
+            }
+            basis.insert(std::move(p));
+        };
+        for (const auto& generator : generators) {
+            trace->generatorSupports.push_back(GetSupport(generator));
+            insert(generator);
+        }
+
+        while (!pairs.empty()) {
+            auto pair = pairs.front();
+            pairs.pop_front();
+            if (AreLeadingTermsCoPrime(basis[pair.first], basis[pair.second])) {
+                continue;
+            }
+            TraceOperation operation{pair.first, pair.second, {}, {}};
+            auto S = S_Polynomial(basis[pair.first], basis[pair.second]);
+            ReduceRecording(basis, &S, false, &operation.steps);
+            if (S != FieldElement(0)) {
+                operation.support = GetSupport(S);
+                trace->pairs.push_back(std::move(operation));
+                insert(std::move(S));
+            }
+        }
+
+        for (auto id : basis.getIds()) {
+            bool isRedundant = std::any_of(basis.begin(), basis.end(), [&](const Poly& other) {
+                return &other != &basis[id] && basis.getLeadingMonomial(id).isDivisibleBy(Poly::getMonomial(other.leadingTerm()));
+            });
+            if (isRedundant) {
+                basis.erase(id);
+            }
+        }
+        trace->minimalIds = basis.getIds();
+        for (auto id : trace->minimalIds) {
+            TraceOperation operation{id, id, {}, {}};
+            basis.modify(id, [&](Poly* p) {
+                ReduceRecording(basis, p, true, &operation.steps);
+                operation.support = GetSupport(*p);
+            });
+            trace->interreductions.push_back(std::move(operation));
+        }
+        basis.normalize();
+        return std::move(basis).toSet();
+    }
+
+    // Repeats the recorded run on other generators with the same supports, skipping the pairs that
+    // reduced to zero and every failed search for a reducer. Skipped pairs are assumed to reduce to zero
+    // as they did on the recorded instance, which holds for generic coefficients but is not checked:
+    // an instance on a special subvariety of the coefficients having the same supports at every step
+    // may get a basis that is not a Groebner one. Returns false if the instance leaves the trace.
+    template <typename FieldElement, typename OrderType>
+    bool ReplayTrace(const ReductionTrace& trace, const std::vector<Polynomial<FieldElement, OrderType>>& generators,
+                     PolynomialSet<FieldElement, OrderType>* result) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        if (generators.size() != trace.generatorSupports.size()) {
+            return false;
+        }
+        Basis<FieldElement, OrderType> basis;
+        for (size_t index = 0; index < generators.size(); ++index) {
+            if (GetSupport(generators[index]) != trace.generatorSupports[index]) {
+                return false;
+            }
+            basis.insert(generators[index]);
+        }
+        basis.normalize();
+
+        for (const auto& operation : trace.pairs) {
+            auto S = S_Polynomial(basis[operation.first], basis[operation.second]);
+            if (!ReplaySteps(basis, operation, &S)) {
+                return false;
+            }
+            S.normalize();
+            basis.insert(std::move(S));
+        }
+
+        for (auto id : basis.getIds()) {
+            if (!std::binary_search(trace.minimalIds.begin(), trace.minimalIds.end(), id)) {
+                basis.erase(id);
+            }
+        }
+        for (const auto& operation : trace.interreductions) {
+            Poly p = basis.extract(operation.first);
+            bool isReplayed = ReplaySteps(basis, operation, &p);
+            basis.replace(operation.first, std::move(p));
+            if (!isReplayed) {
+                return false;
+            }
+        }
+        basis.normalize();
+        *result = std::move(basis).toSet();
+        return true;
+    }
+
+    // Replays the trace, falling back to the full computation if the instance leaves it.
+    template <typename FieldElement, typename OrderType>
+    PolynomialSet<FieldElement, OrderType> SolveWithTrace(const ReductionTrace& trace,
+                                                          const std::vector<Polynomial<FieldElement, OrderType>>& generators,
+                                                          bool* isReplayed = nullptr) {
+        PolynomialSet<FieldElement, OrderType> result;
+        bool replayed = ReplayTrace(trace, generators, &result);
+        if (!replayed) {
+            result = PolynomialSet<FieldElement, OrderType>(generators.begin(), generators.end());
+            DoBuhberger(&result);
+        }
+        if (isReplayed != nullptr) {
+            *isReplayed = replayed;
+        }
+        return result;
+    }
+}
+
+#endif //GROEBNER_TRACE_H
@@ -0,0 +1,151 @@
+#ifndef GROEBNER_TRIANGULAR_H
+#define GROEBNER_TRIANGULAR_H
+
+#include "algorithm.h"
+#include "univariate.h"
+
+namespace Groebner {
+    // Polynomials f_0, ..., f_{n-1} with f_i in k[x_i, ..., x_{n-1}] monic in its main variable x_i,
+    // so the solutions are found by solving f_{n-1}, then f_{n-2} over every root of it and so on.
+    template <typename FieldElement>
+    struct TriangularSet {
+        std::vector<Polynomial<FieldElement, LexOrder>> polynomials;
+        // Multiplicity of the roots of f_{n-1} in the univariate polynomial of the basis.
+        size_t multiplicity;
+    };
+
+    template <typename FieldElement, typename OrderType>
+    UnivariatePolynomial<FieldElement> ToUnivariate(const Polynomial<FieldElement, OrderType>& p, size_t variableIndex) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        std::vector<FieldElement> coefficients;
+        for (const auto& term : p) {
+            const auto& monomial = Poly::getMonomial(term);
+            size_t degree = monomial.degree(variableIndex);
+            if (monomial != Monomial::getNthVariable(variableIndex, degree)) {
+                throw std::runtime_error("Polynomial should depend on one variable.");
+            }
+            coefficients.resize(std::max(coefficients.size(), degree + 1), FieldElement(0));
+            coefficients[degree] = Poly::getCoefficient(term);
+        }
+        return UnivariatePolynomial<FieldElement>(std::move(coefficients));
+    }
+
+    template <typename OrderType, typename FieldElement>
+    Polynomial<FieldElement, OrderType> FromUnivariate(const UnivariatePolynomial<FieldElement>& p, size_t variableIndex) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        std::vector<typename Poly::Term> terms;
+        for (size_t power = 0; power < p.getCoefficients().size(); ++power) {
+            if (p[power] != FieldElement(0)) {
+                terms.emplace_back(Monomial::getNthVariable(variableIndex, power), p[power]);
+            }
+        }
+        return Poly(terms.begin(), terms.end());
+    }
+
+    // Remainder of p modulo the univariate polynomial in the given variable. Terms are grouped by the
+    // other variables and every group is reduced as a dense univariate polynomial.
+    template <typename FieldElement, typename OrderType>
+    Polynomial<FieldElement, OrderType> ReduceByUnivariate(const Polynomial<FieldElement, OrderType>& p,
+                                                           const UnivariatePolynomial<FieldElement>& divisor,
+                                                           size_t variableIndex) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        std::map<Monomial, std::vector<FieldElement>, OrderAdaptor<OrderType>> groups;
+        for (const auto& term : p) {
+            const auto& monomial = Poly::getMonomial(term);
+            size_t degree = monomial.degree(variableIndex);
+            auto& coefficients = groups[monomial / Monomial::getNthVariable(variableIndex, degree)];
+            coefficients.resize(std::max(coefficients.size(), degree + 1), FieldElement(0));
+            coefficients[degree] = Poly::getCoefficient(term);
+        }
+        std::vector<typename Poly::Term> terms;
+        for (auto& group : groups) {
+            auto remainder = UnivariatePolynomial<FieldElement>(std::move(group.second)) % divisor;
+            for (size_t power = 0; power < remainder.getCoefficients().size(); ++power) {
+                if (remainder[power] != FieldElement(0)) {
+                    terms.emplace_back(group.first * Monomial::getNthVariable(variableIndex, power), remainder[power]);
+                }
+            }
+        }
+        return Poly(terms.begin(), terms.end());
+    }
+
+    // Orders a reduced lex basis by the main variables of its elements. Fails unless there is exactly one
+    // element per variable with a pure power of it as the leading monomial, such bases are triangular sets.
+    template <typename FieldElement>
+    bool GetTriangularForm(const PolynomialSet<FieldElement, LexOrder>& basis,
+                           std::vector<Polynomial<FieldElement, LexOrder>>* polynomials) {
+        using Poly = Polynomial<FieldElement, LexOrder>;
+        size_t variablesCount = 0;
+        for (const auto& p : basis) {
+            variablesCount = std::max(variablesCount, GetMaxVariableNumber(p));
+        }
+        if (basis.size() != variablesCount) {
+            return false;
+        }
+        polynomials->assign(variablesCount, Poly());
+        for (const auto& p : basis) {
+            const auto& leadingMonomial = Poly::getMonomial(p.leadingTerm());
+            size_t mainVariable = leadingMonomial.greatestVariableIndex() - 1;
+            if (leadingMonomial != Monomial::getNthVariable(mainVariable, leadingMonomial.totalDegree())
+                || (*polynomials)[mainVariable] != FieldElement(0)) {
+                return false;
+            }
+            (*polynomials)[mainVariable] = p / Poly::getCoefficient(p.leadingTerm());
+        }
+        return true;
+    }
+
+    template <typename FieldElement>
+    bool IsTriangular(const PolynomialSet<FieldElement, LexOrder>& basis) {
+        std::vector<Polynomial<FieldElement, LexOrder>> polynomials;
+        return GetTriangularForm(basis, &polynomials);
+    }
+
+    // Triangular with every variable but the last one linear: x_i - g_i(x_{n-1}) for i < n - 1.
+    template <typename FieldElement>
+    bool IsInShapePosition(const PolynomialSet<FieldElement, LexOrder>& basis) {
+        using Poly = Polynomial<FieldElement, LexOrder>;
+        std::vector<Poly> polynomials;
+        if (!GetTriangularForm(basis, &polynomials)) {
+            return false;
+        }
+        return std::all_of(polynomials.begin(), polynomials.end() - std::min<size_t>(polynomials.size(), 1), [](const Poly& p) {
+            return Poly::getMonomial(p.leadingTerm()).totalDegree() == 1;
+        });
+    }
+
+    // Splits the solutions of a triangular reduced lex basis by the multiplicities of the roots of its
+    // univariate polynomial. The square-free factors are found by the dense univariate arithmetic and
+    // the other elements are reduced modulo each of them, so every set has only simple roots in x_{n-1}.
+    // For a basis in shape position every set gives the coordinates x_i = g_i(x_{n-1}) of its solutions.
+    template <typename FieldElement>
+    std::vector<TriangularSet<FieldElement>> SolveLexBasis(const PolynomialSet<FieldElement, LexOrder>& basis) {
+        using Poly = Polynomial<FieldElement, LexOrder>;
+        std::vector<TriangularSet<FieldElement>> result;
+        if (std::any_of(basis.begin(), basis.end(), [](const Poly& p) {
+            return p != FieldElement(0) && Poly::getMonomial(p.leadingTerm()) == Monomial();
+        })) {
+            return result;
+        }
+        std::vector<Poly> polynomials;
+        if (!GetTriangularForm(basis, &polynomials) || polynomials.empty()) {
+            throw std::runtime_error("Lex basis should be triangular.");
+        }
+        size_t lastVariable = polynomials.size() - 1;
+        auto factors = SquareFreeDecomposition(ToUnivariate(polynomials.back(), lastVariable));
+        for (size_t index = 0; index < factors.size(); ++index) {
+            if (factors[index].degree() == 0) {
+                continue;
+            }
+            TriangularSet<FieldElement> set{{}, index + 1};
+            for (size_t variableIndex = 0; variableIndex < lastVariable; ++variableIndex) {
+                set.polynomials.push_back(ReduceByUnivariate(polynomials[variableIndex], factors[index], lastVariable));
+            }
+            set.polynomials.push_back(FromUnivariate<LexOrder>(factors[index], lastVariable));
+            result.push_back(std::move(set));
+        }
+        return result;
+    }
+}
+
+#endif //GROEBNER_TRIANGULAR_H
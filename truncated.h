@@ -0,0 +1,117 @@
+#ifndef GROEBNER_TRUNCATED_H
+#define GROEBNER_TRUNCATED_H
+
+#include "algorithm.h"
+#include <limits>
+#include <map>
+
+namespace Groebner {
+    template <typename FieldElement, typename OrderType>
+    bool IsHomogeneous(const Polynomial<FieldElement, OrderType>& p) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        return std::all_of(p.begin(), p.end(), [&](const typename Poly::Term& term) {
+            return Poly::getMonomial(term).totalDegree() == Poly::getMonomial(*p.begin()).totalDegree();
+        });
+    }
+
+    // Buchberger algorithm for homogeneous ideals, processing critical pairs degree by degree.
+    // Everything above the requested degree stays pending, so the computation can be resumed.
+    template <typename FieldElement, typename OrderType>
+    class TruncatedBasis {
+        using Poly = Polynomial<FieldElement, OrderType>;
+     public:
+        explicit TruncatedBasis(const PolynomialSet<FieldElement, OrderType>& generators) {
+            for (const auto& generator : generators) {
+                if (generator == FieldElement(0)) {
+                    continue;
+                }
+                if (!IsHomogeneous(generator)) {
+                    throw std::runtime_error("Truncated computation requires homogeneous generators.");
+                }
+                pendingGenerators.emplace(getDegree(generator), generator);
+            }
+        }
+
+        // Returns true if the basis is already complete, i.e. is a Groebner basis in every degree.
+        bool computeUpToDegree(size_t degree) {
+            while (!isComplete() && getNextDegree() <= degree) {
+                size_t nextDegree = getNextDegree();
+                auto generators = pendingGenerators.equal_range(nextDegree);
+                for (auto it = generators.first; it != generators.second; ++it) {
+                    reduceAndInsert(std::move(it->second));
+                }
+                pendingGenerators.erase(generators.first, generators.second);
+
+                auto pairs = pendingPairs.equal_range(nextDegree);
+                std::vector<std::pair<size_t, size_t>> currentPairs;
+                for (auto it = pairs.first; it != pairs.second; ++it) {
+                    currentPairs.push_back(it->second);
+                }
+                pendingPairs.erase(pairs.first, pairs.second);
+                for (const auto& pair : currentPairs) {
+                    reduceAndInsert(S_Polynomial(basis[pair.first], basis[pair.second]));
+                }
+            }
+            reachedDegree = std::max(reachedDegree, degree);
+            return isComplete();
+        }
+
+        bool isComplete() const {
+            return pendingGenerators.empty() && pendingPairs.empty();
+        }
+
+        size_t getReachedDegree() const {
+            return reachedDegree;
+        }
+
+        PolynomialSet<FieldElement, OrderType> getBasis() const {
+            return PolynomialSet<FieldElement, OrderType>(basis.begin(), basis.end());
+        }
+
+        PolynomialSet<FieldElement, OrderType> getReducedBasis() const {
+            auto reducedBasis = getBasis();
+            ReduceSetOverItselfWhilePossible(&reducedBasis);
+            LeadingTermToOne(&reducedBasis);
+            return reducedBasis;
+        }
+     private:
+        std::vector<Poly> basis;
+        std::multimap<size_t, Poly> pendingGenerators;
+        std::multimap<size_t, std::pair<size_t, size_t>> pendingPairs;
+        size_t reachedDegree = 0;
+
+        static size_t getDegree(const Poly& p) {
+            return Poly::getMonomial(p.leadingTerm()).totalDegree();
+        }
+
+        size_t getNextDegree() const {
+            size_t nextDegree = std::numeric_limits<size_t>::max();
+            if (!pendingGenerators.empty()) {
+                nextDegree = pendingGenerators.begin()->first;
+            }
+            if (!pendingPairs.empty()) {
+                nextDegree = std::min(nextDegree, pendingPairs.begin()->first);
+            }
+            return nextDegree;
+        }
+
+        void reduceAndInsert(Poly p) {
+            ReduceOverSetWhilePossible(basis, &p);
+            if (p == FieldElement(0)) {
+                return;
+            }
+            p.normalize();
+            const auto& leadingMonomial = Poly::getMonomial(p.leadingTerm());
+            for (size_t index = 0; index < basis.size(); ++index) {
+                if (!AreLeadingTermsCoPrime(basis[index], p)) {
+                    const auto& otherMonomial = Poly::getMonomial(basis[index].leadingTerm());
+                    pendingPairs.emplace(lcm(leadingMonomial, otherMonomial).totalDegree(),
+                                         std::make_pair(index, basis.size()));
+                }
+            }
+            basis.push_back(std::move(p));
+        }
+    };
+}
+
+#endif //GROEBNER_TRUNCATED_H
@@ -0,0 +1,368 @@
+#ifndef GROEBNER_UNIVARIATE_H
+#define GROEBNER_UNIVARIATE_H
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+namespace Groebner {
+    // Operands shorter than this are multiplied by the schoolbook method.
+    constexpr size_t KaratsubaThreshold = 32;
+    // Pairs of lower degree are handled by the plain Euclidean algorithm.
+    constexpr size_t HalfGcdThreshold = 256;
+
+    // Dense polynomial in one variable, coefficients[i] is the coefficient of x^i.
+    template <typename FieldElement>
+    class UnivariatePolynomial {
+     public:
+        UnivariatePolynomial() = default;
+
+        UnivariatePolynomial(FieldElement constant) : coefficients{std::move(constant)} {
+            trimZeroes();
+        }
+
+        explicit UnivariatePolynomial(std::vector<FieldElement> coefficients) : coefficients(std::move(coefficients)) {
+            trimZeroes();
+        }
+
+        static UnivariatePolynomial getPower(size_t degree) {
+            std::vector<FieldElement> coefficients(degree + 1, FieldElement(0));
+            coefficients.back() = FieldElement(1);
+            return UnivariatePolynomial(std::move(coefficients));
+        }
+
+        bool isZero() const {
+            return coefficients.empty();
+        }
+
+        // Degree of a non-zero polynomial, zero for the zero one.
+        size_t degree() const {
+            return (coefficients.empty() ? 0 : coefficients.size() - 1);
+        }
+
+        FieldElement operator[](size_t power) const {
+            return (power < coefficients.size() ? coefficients[power] : FieldElement(0));
+        }
+
+        const FieldElement& leadingCoefficient() const {
+            return coefficients.back();
+        }
+
+        const std::vector<FieldElement>& getCoefficients() const {
+            return coefficients;
+        }
+
+        UnivariatePolynomial& operator+=(const UnivariatePolynomial& other) {
+            coefficients.resize(std::max(coefficients.size(), other.coefficients.size()), FieldElement(0));
+            for (size_t power = 0; power < other.coefficients.size(); ++power) {
+                coefficients[power] += other.coefficients[power];
+            }
+            trimZeroes();
+            return *this;
+        }
+
+        friend UnivariatePolynomial operator+(UnivariatePolynomial lhs, const UnivariatePolynomial& rhs) {
+            lhs += rhs;
+            return lhs;
+        }
+
+        UnivariatePolynomial& operator-=(const UnivariatePolynomial& other) {
+            coefficients.resize(std::max(coefficients.size(), other.coefficients.size()), FieldElement(0));
+            for (size_t power = 0; power < other.coefficients.size(); ++power) {
+                coefficients[power] -= other.coefficients[power];
+            }
+            trimZeroes();
+            return *this;
+        }
+
+        friend UnivariatePolynomial operator-(UnivariatePolynomial lhs, const UnivariatePolynomial& rhs) {
+            lhs -= rhs;
+            return lhs;
+        }
+
+        friend UnivariatePolynomial operator*(const UnivariatePolynomial& lhs, const UnivariatePolynomial& rhs) {
+            return UnivariatePolynomial(multiply(lhs.coefficients, rhs.coefficients));
+        }
+
+        UnivariatePolynomial& operator*=(const UnivariatePolynomial& other) {
+            *this = (*this) * other;
+            return *this;
+        }
+
+        friend void Divide(const UnivariatePolynomial& dividend, const UnivariatePolynomial& divisor,
+                           UnivariatePolynomial* quotient, UnivariatePolynomial* remainder) {
+            if (divisor.isZero()) {
+                throw std::runtime_error("Division by zero polynomial.");
+            }
+            std::vector<FieldElement> rest(dividend.coefficients);
+            std::vector<FieldElement> quotientCoefficients;
+            if (rest.size() >= divisor.coefficients.size()) {
+                quotientCoefficients.assign(rest.size() - divisor.coefficients.size() + 1, FieldElement(0));
+                FieldElement inverse = FieldElement(1) / divisor.leadingCoefficient();
+                for (size_t shift = quotientCoefficients.size(); shift-- > 0;) {
+                    FieldElement factor = rest[shift + divisor.degree()] * inverse;
+                    quotientCoefficients[shift] = factor;
+                    if (factor == FieldElement(0)) {
+                        continue;
+                    }
+                    for (size_t power = 0; power < divisor.coefficients.size(); ++power) {
+                        rest[shift + power] -= factor * divisor.coefficients[power];
+                    }
+                }
+                rest.resize(divisor.degree());
+            }
+            if (quotient != nullptr) {
+                *quotient = UnivariatePolynomial(std::move(quotientCoefficients));
+            }
+            if (remainder != nullptr) {
+                *remainder = UnivariatePolynomial(std::move(rest));
+            }
+        }
+
+        friend UnivariatePolynomial operator/(const UnivariatePolynomial& lhs, const UnivariatePolynomial& rhs) {
+            UnivariatePolynomial quotient;
+            Divide(lhs, rhs, &quotient, nullptr);
+            return quotient;
+        }
+
+        friend UnivariatePolynomial operator%(const UnivariatePolynomial& lhs, const UnivariatePolynomial& rhs) {
+            UnivariatePolynomial remainder;
+            Divide(lhs, rhs, nullptr, &remainder);
+            return remainder;
+        }
+
+        UnivariatePolynomial derivative() const {
+            std::vector<FieldElement> result;
+            for (size_t power = 1; power < coefficients.size(); ++power) {
+                result.push_back(coefficients[power] * FieldElement(static_cast<long long>(power)));
+            }
+            return UnivariatePolynomial(std::move(result));
+        }
+
+        // Quotient of the division by x^shift.
+        UnivariatePolynomial shiftRight(size_t shift) const {
+            if (shift >= coefficients.size()) {
+                return UnivariatePolynomial();
+            }
+            return UnivariatePolynomial(std::vector<FieldElement>(coefficients.begin() + shift, coefficients.end()));
+        }
+
+        UnivariatePolynomial monic() const {
+            UnivariatePolynomial result(*this);
+            for (auto& coefficient : result.coefficients) {
+                coefficient /= leadingCoefficient();
+            }
+            return result;
+        }
+
+        FieldElement evaluate(const FieldElement& point) const {
+            FieldElement result(0);
+            for (size_t power = coefficients.size(); power-- > 0;) {
+                result = result * point + coefficients[power];
+            }
+            return result;
+        }
+
+        friend bool operator==(const UnivariatePolynomial& lhs, const UnivariatePolynomial& rhs) {
+            return lhs.coefficients == rhs.coefficients;
+        }
+
+        friend bool operator!=(const UnivariatePolynomial& lhs, const UnivariatePolynomial& rhs) {
+            return !(lhs == rhs);
+        }
+
+        friend std::ostream& operator<<(std::ostream& os, const UnivariatePolynomial& p) {
+            for (size_t power = 0; power < p.coefficients.size(); ++power) {
+                if (power != 0) {
+                    os << " + ";
+                }
+                os << p.coefficients[power] << "x^" << power;
+            }
+            return os;
+        }
+     private:
+        std::vector<FieldElement> coefficients;
+
+        void trimZeroes() {
+            while (!coefficients.empty() && coefficients.back() == FieldElement(0)) {
+                coefficients.pop_back();
+            }
+        }
+
+        static void addShifted(std::vector<FieldElement>* result, const std::vector<FieldElement>& summand, size_t shift) {
+            if (result->size() < summand.size() + shift) {
+                result->resize(summand.size() + shift, FieldElement(0));
+            }
+            for (size_t power = 0; power < summand.size(); ++power) {
+                (*result)[power + shift] += summand[power];
+            }
+        }
+
+        static std::vector<FieldElement> add(std::vector<FieldElement> lhs, const std::vector<FieldElement>& rhs) {
+            addShifted(&lhs, rhs, 0);
+            return lhs;
+        }
+
+        // Karatsuba multiplication: with a = a0 + x^half a1 and b = b0 + x^half b1 the middle part
+        // a0 b1 + a1 b0 is (a0 + a1)(b0 + b1) - a0 b0 - a1 b1, so three products of halves are enough.
+        static std::vector<FieldElement> multiply(const std::vector<FieldElement>& lhs, const std::vector<FieldElement>& rhs) {
+            if (lhs.empty() || rhs.empty()) {
+                return {};
+            }
+            if (std::min(lhs.size(), rhs.size()) < KaratsubaThreshold) {
+                std::vector<FieldElement> result(lhs.size() + rhs.size() - 1, FieldElement(0));
+                for (size_t left = 0; left < lhs.size(); ++left) {
+                    for (size_t right = 0; right < rhs.size(); ++right) {
+                        result[left + right] += lhs[left] * rhs[right];
+                    }
+                }
+                return result;
+            }
+            size_t half = std::max(lhs.size(), rhs.size()) / 2;
+            auto split = [half](const std::vector<FieldElement>& p) {
+                auto middle = p.begin() + std::min(half, p.size());
+                return std::make_pair(std::vector<FieldElement>(p.begin(), middle), std::vector<FieldElement>(middle, p.end()));
+            };
+            auto [lhsLow, lhsHigh] = split(lhs);
+            auto [rhsLow, rhsHigh] = split(rhs);
+            std::vector<FieldElement> result;
+            if (lhsHigh.empty() || rhsHigh.empty()) {
+                // One operand fits into the lower half, so only two products are needed.
+                const auto& shorter = (lhsHigh.empty() ? lhs : rhs);
+                const auto& longerLow = (lhsHigh.empty() ? rhsLow : lhsLow);
+                const auto& longerHigh = (lhsHigh.empty() ? rhsHigh : lhsHigh);
+                addShifted(&result, multiply(shorter, longerLow), 0);
+                addShifted(&result, multiply(shorter, longerHigh), half);
+                return result;
+            }
+            auto low = multiply(lhsLow, rhsLow);
+            auto high = multiply(lhsHigh, rhsHigh);
+            auto middle = multiply(add(lhsLow, lhsHigh), add(rhsLow, rhsHigh));
+            for (size_t power = 0; power < low.size(); ++power) {
+                middle[power] -= low[power];
+            }
+            for (size_t power = 0; power < high.size(); ++power) {
+                middle[power] -= high[power];
+            }
+            addShifted(&result, low, 0);
+            addShifted(&result, middle, half);
+            addShifted(&result, high, 2 * half);
+            return result;
+        }
+    };
+
+    // Row-major 2x2 matrix of polynomials, applied to pairs of consecutive remainders.
+    template <typename FieldElement>
+    using PolynomialMatrix = std::array<UnivariatePolynomial<FieldElement>, 4>;
+
+    template <typename FieldElement>
+    PolynomialMatrix<FieldElement> GetIdentityMatrix() {
+        return {FieldElement(1), FieldElement(0), FieldElement(0), FieldElement(1)};
+    }
+
+    template <typename FieldElement>
+    PolynomialMatrix<FieldElement> MultiplyMatrices(const PolynomialMatrix<FieldElement>& lhs, const PolynomialMatrix<FieldElement>& rhs) {
+        return {lhs[0] * rhs[0] + lhs[1] * rhs[2], lhs[0] * rhs[1] + lhs[1] * rhs[3],
+                lhs[2] * rhs[0] + lhs[3] * rhs[2], lhs[2] * rhs[1] + lhs[3] * rhs[3]};
+    }
+
+    template <typename FieldElement>
+    void ApplyMatrix(const PolynomialMatrix<FieldElement>& matrix, UnivariatePolynomial<FieldElement>* a,
+                     UnivariatePolynomial<FieldElement>* b) {
+        auto newA = matrix[0] * (*a) + matrix[1] * (*b);
+        auto newB = matrix[2] * (*a) + matrix[3] * (*b);
+        *a = std::move(newA);
+        *b = std::move(newB);
+    }
+
+    // For deg a = n > deg b returns the product of the Euclidean steps taking (a, b) to the consecutive remainders
+    // with degrees on both sides of n / 2. Quotients depend only on the upper halves of the operands, so they are
+    // found recursively on them. Every step is unimodular, so the gcd is kept whatever the degrees turn out to be.
+    template <typename FieldElement>
+    PolynomialMatrix<FieldElement> HalfGcd(const UnivariatePolynomial<FieldElement>& a, const UnivariatePolynomial<FieldElement>& b) {
+        using Univariate = UnivariatePolynomial<FieldElement>;
+        size_t half = (a.degree() + 1) / 2;
+        if (b.isZero() || b.degree() < half) {
+            return GetIdentityMatrix<FieldElement>();
+        }
+        if (a.degree() < HalfGcdThreshold) {
+            // Plain Euclidean steps, the rows of the matrix follow the remainders.
+            auto matrix = GetIdentityMatrix<FieldElement>();
+            Univariate current(a);
+            Univariate next(b);
+            while (!next.isZero() && next.degree() >= half) {
+                Univariate quotient;
+                Univariate remainder;
+                Divide(current, next, &quotient, &remainder);
+                matrix = {matrix[2], matrix[3], matrix[0] - quotient * matrix[2], matrix[1] - quotient * matrix[3]};
+                current = std::move(next);
+                next = std::move(remainder);
+            }
+            return matrix;
+        }
+        auto first = HalfGcd(a.shiftRight(half), b.shiftRight(half));
+        Univariate current(a);
+        Univariate next(b);
+        ApplyMatrix(first, &current, &next);
+        if (next.isZero() || next.degree() < half) {
+            return first;
+        }
+        Univariate quotient;
+        Univariate remainder;
+        Divide(current, next, &quotient, &remainder);
+        PolynomialMatrix<FieldElement> step = {FieldElement(0), FieldElement(1), FieldElement(1), Univariate() - quotient};
+        auto result = MultiplyMatrices(step, first);
+        size_t nextDegree = next.degree();
+        if (remainder.isZero() || remainder.degree() < half || 2 * half <= nextDegree || 2 * (nextDegree - half) >= a.degree()) {
+            return result;
+        }
+        size_t shift = 2 * half - nextDegree;
+        return MultiplyMatrices(HalfGcd(next.shiftRight(shift), remainder.shiftRight(shift)), result);
+    }
+
+    // Monic greatest common divisor, zero if both polynomials are zero.
+    template <typename FieldElement>
+    UnivariatePolynomial<FieldElement> Gcd(UnivariatePolynomial<FieldElement> a, UnivariatePolynomial<FieldElement> b) {
+        while (!b.isZero()) {
+            if (a.degree() < b.degree()) {
+                std::swap(a, b);
+            }
+            if (b.degree() >= HalfGcdThreshold && a.degree() > b.degree()) {
+                ApplyMatrix(HalfGcd(a, b), &a, &b);
+                if (b.isZero()) {
+                    break;
+                }
+            }
+            auto remainder = a % b;
+            a = std::move(b);
+            b = std::move(remainder);
+        }
+        return (a.isZero() ? a : a.monic());
+    }
+
+    // Yun's algorithm: returns factors with f equal to the leading coefficient times the product of factors[i]^(i + 1),
+    // the factors being square-free and pairwise coprime. Characteristic should exceed the degree of f.
+    template <typename FieldElement>
+    std::vector<UnivariatePolynomial<FieldElement>> SquareFreeDecomposition(const UnivariatePolynomial<FieldElement>& f) {
+        using Univariate = UnivariatePolynomial<FieldElement>;
+        std::vector<Univariate> factors;
+        if (f.isZero() || f.degree() == 0) {
+            return factors;
+        }
+        auto derivative = f.derivative();
+        auto common = Gcd(f, derivative);
+        Univariate b = f / common;
+        Univariate d = derivative / common - b.derivative();
+        while (b.degree() > 0) {
+            auto factor = Gcd(b, d);
+            factors.push_back(factor);
+            b = b / factor;
+            d = d / factor - b.derivative();
+        }
+        return factors;
+    }
+}
+
+#endif //GROEBNER_UNIVARIATE_H
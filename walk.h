@@ -0,0 +1,244 @@
+#ifndef GROEBNER_WALK_H
+#define GROEBNER_WALK_H
+
+#include "algorithm.h"
+#include <boost/integer/common_factor.hpp>
+
+namespace Groebner {
+    using WeightVector = std::vector<long long>;
+
+    // Weight vector refined by the order: monomials of greater weight are always greater.
+    // The walk goes to it, so the orders along the path are the target order with this weight put first.
+    template <typename OrderType>
+    struct WalkWeight;
+
+    template <>
+    struct WalkWeight<LexOrder> {
+        static WeightVector get(size_t variablesCount) {
+            WeightVector weight(variablesCount, 0);
+            if (variablesCount > 0) {
+                weight[0] = 1;
+            }
+            return weight;
+        }
+    };
+
+    template <typename TOrder>
+    struct WalkWeight<Sum<DegreeOrder, TOrder>> {
+        static WeightVector get(size_t variablesCount) {
+            return WeightVector(variablesCount, 1);
+        }
+    };
+
+    template <size_t BlockSize, typename TOrder1, typename TOrder2>
+    struct WalkWeight<Sum<Restriction<0, BlockSize, TOrder1>, Restriction<BlockSize, std::numeric_limits<size_t>::max(), TOrder2>>> {
+        static WeightVector get(size_t variablesCount) {
+            WeightVector weight = WalkWeight<TOrder1>::get(std::min(BlockSize, variablesCount));
+            weight.resize(variablesCount, 0);
+            return weight;
+        }
+    };
+
+    inline long long GetWeight(const Monomial& m, const WeightVector& weight) {
+        long long result = 0;
+        for (size_t variableIndex = 0; variableIndex < std::min(weight.size(), m.greatestVariableIndex()); ++variableIndex) {
+            result += weight[variableIndex] * static_cast<long long>(m.degree(variableIndex));
+        }
+        return result;
+    }
+
+    // Polynomial stored in the target order together with its leading monomial in the current order of the walk.
+    template <typename FieldElement, typename OrderType>
+    struct MarkedPolynomial {
+        Polynomial<FieldElement, OrderType> polynomial;
+        Monomial mark;
+    };
+
+    template <typename FieldElement, typename OrderType>
+    using MarkedBasis = std::vector<MarkedPolynomial<FieldElement, OrderType>>;
+
+    // Sum of the terms of the greatest weight.
+    template <typename FieldElement, typename OrderType>
+    Polynomial<FieldElement, OrderType> GetInitialForm(const Polynomial<FieldElement, OrderType>& p, const WeightVector& weight) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        long long maxWeight = std::numeric_limits<long long>::min();
+        for (const auto& term : p) {
+            maxWeight = std::max(maxWeight, GetWeight(Poly::getMonomial(term), weight));
+        }
+        std::vector<typename Poly::Term> terms;
+        std::copy_if(p.begin(), p.end(), std::back_inserter(terms), [&](const typename Poly::Term& term) {
+            return GetWeight(Poly::getMonomial(term), weight) == maxWeight;
+        });
+        return Poly(terms.begin(), terms.end());
+    }
+
+    // Finds the first weight on the segment from current to target where some term overtakes the mark of its
+    // polynomial, that is where the mark disagrees with the target weight. Weights are kept integer.
+    template <typename FieldElement, typename OrderType>
+    bool FindNextWeight(const MarkedBasis<FieldElement, OrderType>& basis, const WeightVector& current,
+                        const WeightVector& target, WeightVector* next) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        using Ratio = boost::rational<long long>;
+        bool isFound = false;
+        Ratio step(1);
+        for (const auto& marked : basis) {
+            long long markCurrent = GetWeight(marked.mark, current);
+            long long markTarget = GetWeight(marked.mark, target);
+            for (const auto& term : marked.polynomial) {
+                long long currentDifference = markCurrent - GetWeight(Poly::getMonomial(term), current);
+                long long targetDifference = markTarget - GetWeight(Poly::getMonomial(term), target);
+                if (targetDifference >= 0) {
+                    continue;
+                }
+                Ratio termStep(currentDifference, currentDifference - targetDifference);
+                if (!isFound || termStep < step) {
+                    step = termStep;
+                    isFound = true;
+                }
+            }
+        }
+        if (!isFound) {
+            return false;
+        }
+        next->resize(current.size());
+        long long gcd = 0;
+        for (size_t variableIndex = 0; variableIndex < current.size(); ++variableIndex) {
+            (*next)[variableIndex] = (step.denominator() - step.numerator()) * current[variableIndex]
+                                     + step.numerator() * target[variableIndex];
+            gcd = boost::integer::gcd(gcd, (*next)[variableIndex]);
+        }
+        for (auto& coordinate : *next) {
+            coordinate /= std::max(gcd, 1ll);
+        }
+        return true;
+    }
+
+    // Reduces the terms of p divisible by the marks of the basis elements other than the skipped one.
+    // Terminates since the marks are the leading monomials in some monomial order.
+    template <typename FieldElement, typename OrderType>
+    void ReduceByMarks(const MarkedBasis<FieldElement, OrderType>& basis, size_t skippedIndex,
+                       Polynomial<FieldElement, OrderType>* p, std::vector<Polynomial<FieldElement, OrderType>>* quotients = nullptr) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        auto findReducer = [&](Monomial* monomial) {
+            for (auto term = p->rbegin(); term != p->rend(); ++term) {
+                for (size_t index = 0; index < basis.size(); ++index) {
+                    if (index != skippedIndex && Poly::getMonomial(*term).isDivisibleBy(basis[index].mark)) {
+                        *monomial = Poly::getMonomial(*term);
+                        return index;
+                    }
+                }
+            }
+            return basis.size();
+        };
+        Monomial monomial;
+        for (size_t index = findReducer(&monomial); index != basis.size(); index = findReducer(&monomial)) {
+            const auto& marked = basis[index];
+            Monomial multiplier = monomial / marked.mark;
+            FieldElement coefficient = p->getCoefficientOf(monomial) / marked.polynomial.getCoefficientOf(marked.mark);
+            if (quotients != nullptr) {
+                (*quotients)[index] += Poly({{multiplier, coefficient}});
+            }
+            p->subtractMultiple(multiplier, coefficient, marked.polynomial);
+        }
+    }
+
+    // Moves the basis to the order given by the weight and refined by OrderType. The reduced basis of the
+    // initial forms is computed in OrderType, which is enough since they are homogeneous with respect to the weight.
+    // Every element of it is lifted by the quotients of its division by the initial forms marked as before.
+    // On abort of the inner computation the basis is left unchanged and the status is returned.
+    template <typename FieldElement, typename OrderType>
+    BuhbergerStatus DoWalkStep(MarkedBasis<FieldElement, OrderType>* basis, const WeightVector& weight,
+                               const BuhbergerOptions& options = BuhbergerOptions()) {
+        using Poly = Polynomial<FieldElement, OrderType>;
+        MarkedBasis<FieldElement, OrderType> initialForms;
+        PolynomialSet<FieldElement, OrderType> initialIdeal;
+        for (const auto& marked : *basis) {
+            initialForms.push_back({GetInitialForm(marked.polynomial, weight), marked.mark});
+            initialIdeal.insert(initialForms.back().polynomial);
+        }
+        auto status = DoBuhberger(&initialIdeal, options);
+        if (status != BuhbergerStatus::Completed) {
+            return status;
+        }
+
+        BuhbergerController controller(options);
+        MarkedBasis<FieldElement, OrderType> lifted;
+        for (const auto& h : initialIdeal) {
+            if (controller.shouldStop()) {
+                return controller.getStatus();
+            }
+            auto remainder = h;
+            std::vector<Poly> quotients(basis->size());
+            ReduceByMarks(initialForms, initialForms.size(), &remainder, &quotients);
+            if (remainder != FieldElement(0)) {
+                throw std::runtime_error("Initial forms should form a Groebner basis of the initial ideal.");
+            }
+            Poly liftedPolynomial;
+            for (size_t index = 0; index < quotients.size(); ++index) {
+                for (const auto& term : quotients[index]) {
+                    liftedPolynomial.addMultiple(Poly::getMonomial(term), Poly::getCoefficient(term), (*basis)[index].polynomial);
+                }
+            }
+            lifted.push_back({std::move(liftedPolynomial), Poly::getMonomial(h.leadingTerm())});
+        }
+
+        for (size_t index = 0; index < lifted.size(); ++index) {
+            if (controller.shouldStop()) {
+                return controller.getStatus();
+            }
+            ReduceByMarks(lifted, index, &lifted[index].polynomial);
+            lifted[index].polynomial /= FieldElement(lifted[index].polynomial.getCoefficientOf(lifted[index].mark));
+        }
+        *basis = std::move(lifted);
+        return BuhbergerStatus::Completed;
+    }
+
+    // Groebner walk from DegRevLex, where the basis is computed first, to TargetOrder along the segment
+    // from the weight of ones to the weight refined by TargetOrder. Only bases of initial forms are computed
+    // on the way, which unlike FGLM works for ideals of positive dimension. The options apply to every inner
+    // computation; on abort the status is stored and the result only generates the ideal.
+    template <typename TargetOrder, typename FieldElement>
+    PolynomialSet<FieldElement, TargetOrder> DoGroebnerWalk(PolynomialSet<FieldElement, DegreeRevLexOrder> ideal,
+                                                            const BuhbergerOptions& options = BuhbergerOptions(),
+                                                            BuhbergerStatus* status = nullptr) {
+        using Poly = Polynomial<FieldElement, TargetOrder>;
+        BuhbergerStatus walkStatus = DoBuhberger(&ideal, options);
+        size_t variablesCount = 0;
+        MarkedBasis<FieldElement, TargetOrder> basis;
+        for (const auto& p : ideal) {
+            variablesCount = std::max(variablesCount, GetMaxVariableNumber(p));
+            basis.push_back({ChangeOrder<TargetOrder>(p), Polynomial<FieldElement, DegreeRevLexOrder>::getMonomial(p.leadingTerm())});
+        }
+
+        WeightVector current(variablesCount, 1);
+        WeightVector target = WalkWeight<TargetOrder>::get(variablesCount);
+        WeightVector next;
+        bool isTieBrokenByTarget = false;
+        while (walkStatus == BuhbergerStatus::Completed && FindNextWeight(basis, current, target, &next)) {
+            // Once ties are broken by the target order, marks can only be overtaken further along the path.
+            if (next == current && isTieBrokenByTarget) {
+                throw std::runtime_error("Target order should refine its walk weight.");
+            }
+            walkStatus = DoWalkStep(&basis, next, options);
+            current = next;
+            isTieBrokenByTarget = true;
+        }
+        bool isTargetMarked = std::all_of(basis.begin(), basis.end(), [](const MarkedPolynomial<FieldElement, TargetOrder>& marked) {
+            return marked.mark == Poly::getMonomial(marked.polynomial.leadingTerm());
+        });
+        if (walkStatus == BuhbergerStatus::Completed && !isTargetMarked) {
+            walkStatus = DoWalkStep(&basis, target, options);
+        }
+        if (status != nullptr) {
+            *status = walkStatus;
+        }
+
+        PolynomialSet<FieldElement, TargetOrder> result;
+        for (auto& marked : basis) {
+            result.insert(std::move(marked.polynomial));
+        }
+        return result;
+    }
+}
+
+#endif //GROEBNER_WALK_H